@@ -0,0 +1,81 @@
+#pragma once
+#include <JuceHeader.h>
+#include "Chopper.h"
+
+struct Fixture {
+    String name = "";
+    double seconds = 0.0;
+    double sampleRate = 44100.0;
+    File file;
+    std::vector<float> conf;
+};
+
+class Fixtures {
+public:
+    static constexpr double sampleRate = 44100.0;
+    static constexpr int numChannels = 2;
+    static constexpr double noiseGain = 0.003;
+
+    static auto create(const File& folder, double seconds, int64 seed = 1) -> Fixture {
+        Fixture fixture;
+        fixture.name = "vocal-" + String{static_cast<int>(seconds)} + "s";
+        fixture.seconds = seconds;
+        fixture.sampleRate = sampleRate;
+        fixture.file = folder.getChildFile(fixture.name + ".wav");
+
+        auto numSamples = static_cast<int>(seconds * sampleRate);
+        auto hop = Chopper::Options{}.hopSeconds;
+        fixture.conf.assign(static_cast<size_t>(std::ceil(seconds / hop)), 0.0f);
+
+        AudioBuffer<float> audio{numChannels, numSamples};
+        audio.clear();
+        Random random{seed};
+
+        for (int i = 0; i < numSamples; i++) {
+            auto noise = static_cast<float>((random.nextDouble() * 2.0 - 1.0) * noiseGain);
+            for (int ch = 0; ch < numChannels; ch++) audio.setSample(ch, i, noise);
+        }
+
+        for (auto position = random.nextDouble() * 0.5; position < seconds;) {
+            auto length = jmin(0.4 + random.nextDouble() * 0.8, seconds - position);
+            auto startFreq = 180.0 + random.nextDouble() * 300.0;
+            auto endFreq = startFreq * std::pow(2.0, (random.nextDouble() - 0.5) * 1.5);
+            addPhrase(audio, position, length, startFreq, endFreq, 0.3 + random.nextDouble() * 0.4);
+
+            auto first = static_cast<size_t>(position / hop);
+            auto last = jmin(fixture.conf.size(), static_cast<size_t>((position + length) / hop));
+            for (auto frame = first; frame < last; frame++) fixture.conf[frame] = 0.9f;
+
+            position += length + 0.2 + random.nextDouble() * 0.4;
+        }
+
+        Chopper::writeChop(fixture.file, audio, sampleRate, 24);
+        return fixture;
+    }
+
+private:
+    static auto addPhrase(AudioBuffer<float>& audio, double start, double length, double startFreq, double endFreq, double gain) -> void {
+        static constexpr double vibratoRate = 5.5;
+        static constexpr double vibratoCents = 30.0;
+        static constexpr int numHarmonics = 6;
+        static constexpr double attack = 0.03;
+
+        auto first = static_cast<int>(start * sampleRate);
+        auto numSamples = jmin(static_cast<int>(length * sampleRate), audio.getNumSamples() - first);
+        auto phase = 0.0;
+
+        for (int i = 0; i < numSamples; i++) {
+            auto t = i / sampleRate;
+            auto sweep = startFreq * std::pow(endFreq / startFreq, t / length);
+            auto vibrato = std::pow(2.0, vibratoCents / 1200.0 * std::sin(MathConstants<double>::twoPi * vibratoRate * t));
+            phase += MathConstants<double>::twoPi * sweep * vibrato / sampleRate;
+
+            auto envelope = jmin(1.0, t / attack, (length - t) / attack);
+            auto sample = 0.0;
+            for (int h = 1; h <= numHarmonics; h++) sample += std::sin(phase * h) / (h * h);
+
+            auto value = static_cast<float>(sample * envelope * gain);
+            for (int ch = 0; ch < audio.getNumChannels(); ch++) audio.addSample(ch, first + i, value);
+        }
+    }
+};
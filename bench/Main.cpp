@@ -0,0 +1,276 @@
+#include <JuceHeader.h>
+#include "AudioLoader.hpp"
+#include "CaptureRecorder.h"
+#include "ChopPreview.h"
+#include "Chopper.h"
+#include "Crepe.h"
+#include "PythonWorker.hpp"
+#include "StemCache.hpp"
+#include "StreamingChopper.h"
+#include "WebviewAssets.hpp"
+#include "Fixtures.hpp"
+#include "Metrics.hpp"
+
+struct BenchOptions {
+    Array<double> lengths{10.0, 60.0, 240.0};
+    Array<int> threads{1, 2, 4, 8};
+    int iterations = 3;
+    bool separation = false;
+    double realtimeSeconds = 5.0;
+    File folder;
+};
+
+static auto printUsage() -> void {
+    std::cout << "Usage: VocalChopperBench [options]\n"
+        << "  --lengths <seconds,...>   Fixture lengths (default 10,60,240)\n"
+        << "  --threads <count,...>     Export thread counts (default 1,2,4,8)\n"
+        << "  --iterations <count>      Repetitions per stage, the median is reported (default 3)\n"
+        << "  --separation              Also time vocal separation through the python worker\n"
+        << "  --realtime <seconds>      Length of the paced audio thread run (default 5)\n"
+        << "  --output <file>           Write the JSON report to a file as well as stdout\n"
+        << "  --keep                    Keep the generated fixtures and chops" << std::endl;
+}
+
+static auto readSource(const File& file) -> AudioBuffer<float> {
+    auto reader = AudioLoader::createReader(file);
+    if (reader == nullptr) return {};
+    AudioBuffer<float> audio{static_cast<int>(reader->numChannels), static_cast<int>(reader->lengthInSamples)};
+    reader->read(&audio, 0, audio.getNumSamples(), 0, true, true);
+    return audio;
+}
+
+static auto benchStartup(const BenchOptions& options) -> var {
+    auto sample = Metrics::repeat(options.iterations, []() {
+        WebviewAssets assets;
+        [[maybe_unused]] auto index = assets.find("index.html");
+    });
+    return Metrics::toVar("startup", sample);
+}
+
+static auto benchStreaming(const Fixture& fixture, const AudioBuffer<float>& source, std::shared_ptr<Crepe> model,
+    const File& outputFolder) -> var {
+    static constexpr int blockSize = 512;
+    CriticalSection lock;
+    std::vector<double> latencies;
+
+    auto sample = Metrics::measure([&]() {
+        StreamingChopper chopper{model, outputFolder, fixture.sampleRate, {}, [&](const StreamingChopper::Chop& chop) {
+            const ScopedLock sl{lock};
+            latencies.push_back(chop.latencyMs);
+        }};
+        for (int position = 0; position < source.getNumSamples(); position += blockSize) {
+            auto numSamples = jmin(blockSize, source.getNumSamples() - position);
+            const float* channels[Fixtures::numChannels] = {};
+            for (int ch = 0; ch < source.getNumChannels(); ch++) channels[ch] = source.getReadPointer(ch, position);
+            chopper.append(channels, source.getNumChannels(), numSamples);
+        }
+        chopper.finish();
+    });
+
+    auto result = Metrics::toVar("streaming", sample, fixture.seconds);
+    auto mean = latencies.empty() ? 0.0 : std::accumulate(latencies.begin(), latencies.end(), 0.0) / static_cast<double>(latencies.size());
+    result.getDynamicObject()->setProperty("chops", static_cast<int>(latencies.size()));
+    result.getDynamicObject()->setProperty("latencyMeanMs", mean);
+    result.getDynamicObject()->setProperty("latencyP95Ms", Metrics::percentile(latencies, 0.95));
+    result.getDynamicObject()->setProperty("latencyMaxMs", Metrics::percentile(latencies, 1.0));
+    return result;
+}
+
+static auto benchRealtime(const BenchOptions& options, const AudioBuffer<float>& source, const File& chopFolder) -> var {
+    static constexpr double sampleRate = Fixtures::sampleRate;
+    static constexpr int blockSize = 512;
+    static constexpr int triggerInterval = 20;
+
+    CaptureRecorder capture;
+    ChopPreview preview;
+    capture.prepare(sampleRate, blockSize, source.getNumChannels());
+    preview.prepare(sampleRate, blockSize);
+    auto numChops = preview.load(chopFolder);
+
+    auto take = options.folder.getChildFile("realtime-take.wav");
+    capture.start(take);
+
+    AudioBuffer<float> block{source.getNumChannels(), blockSize};
+    std::vector<double> durations;
+    auto numBlocks = static_cast<int>(options.realtimeSeconds * sampleRate / blockSize);
+    auto budgetMs = blockSize / sampleRate * 1000.0;
+    auto next = Time::getMillisecondCounterHiRes();
+
+    for (int i = 0; i < numBlocks; i++) {
+        auto position = (i * blockSize) % jmax(1, source.getNumSamples() - blockSize);
+        for (int ch = 0; ch < block.getNumChannels(); ch++) block.copyFrom(ch, 0, source, ch, position, blockSize);
+        if (numChops > 0 && i % triggerInterval == 0) preview.trigger((i / triggerInterval) % numChops);
+
+        auto start = Time::getMillisecondCounterHiRes();
+        capture.push(block);
+        preview.render(block);
+        durations.push_back(Time::getMillisecondCounterHiRes() - start);
+
+        next += budgetMs;
+        auto wait = next - Time::getMillisecondCounterHiRes();
+        if (wait >= 1.0) Thread::sleep(static_cast<int>(wait));
+    }
+    capture.stop();
+    take.deleteFile();
+
+    auto overruns = std::count_if(durations.begin(), durations.end(), [budgetMs](auto duration) { return duration > budgetMs; });
+    auto* obj = new DynamicObject();
+    obj->setProperty("stage", "realtime");
+    obj->setProperty("blocks", numBlocks);
+    obj->setProperty("budgetMs", budgetMs);
+    obj->setProperty("p50Ms", Metrics::percentile(durations, 0.5));
+    obj->setProperty("p99Ms", Metrics::percentile(durations, 0.99));
+    obj->setProperty("maxMs", Metrics::percentile(durations, 1.0));
+    obj->setProperty("overruns", static_cast<int>(overruns));
+    obj->setProperty("droppedSamples", capture.getDroppedSamples());
+    return var{obj};
+}
+
+static auto benchFixture(const BenchOptions& options, const Fixture& fixture, PythonWorker& worker) -> var {
+    Array<var> stages;
+    auto chopOptions = Chopper::Options{};
+    auto outputFolder = options.folder.getChildFile(fixture.name);
+
+    if (options.separation) {
+        auto vocals = options.folder.getChildFile(fixture.name + "-vocals.wav");
+        auto sample = Metrics::measure([&]() {
+            auto* request = new DynamicObject();
+            request->setProperty("command", "separate");
+            request->setProperty("input", fixture.file.getFullPathName());
+            request->setProperty("output", vocals.getFullPathName());
+            request->setProperty("model", StemCache::modelName);
+            worker.request(var{request}, [](const PythonWorker::Progress&) {}, []() { return false; });
+        });
+        auto result = Metrics::toVar("separate", sample, fixture.seconds);
+        result.getDynamicObject()->setProperty("succeeded", vocals.existsAsFile());
+        result.getDynamicObject()->setProperty("worker", true);
+        stages.add(result);
+        vocals.deleteFile();
+    }
+
+    auto reader = AudioLoader::createReader(fixture.file);
+    if (reader == nullptr) return {};
+    AudioFormatReaderSource source{reader.get(), false};
+    auto numChannels = static_cast<int>(reader->numChannels);
+    auto total = AudioLoader::getMonoLength(source, reader->sampleRate, Crepe::sampleRate);
+
+    stages.add(Metrics::toVar("load", Metrics::repeat(options.iterations, [&]() {
+        AudioLoader::streamMono(source, numChannels, reader->sampleRate, Crepe::sampleRate, 0, total, [](const float*, int) { return true; });
+    }), fixture.seconds));
+
+    auto model = Crepe::getShared();
+    auto conf = fixture.conf;
+    if (model != nullptr) {
+        PitchFrames frames;
+        stages.add(Metrics::toVar("pitch", Metrics::repeat(options.iterations, [&]() {
+            Crepe::ConfidenceStream stream{*model};
+            AudioLoader::streamMono(source, numChannels, reader->sampleRate, Crepe::sampleRate, 0, total, [&](const float* samples, int numSamples) {
+                stream.push(samples, numSamples);
+                return true;
+            });
+            frames = stream.finish();
+        }), fixture.seconds));
+        conf = frames.conf;
+    }
+
+    std::vector<ChopRegion> chops;
+    auto segment = Metrics::toVar("segment", Metrics::repeat(options.iterations, [&]() {
+        auto regions = Chopper::findRegions(conf, Crepe::sampleRate, chopOptions);
+        chops = Chopper::selectChops(source, numChannels, reader->sampleRate, Crepe::sampleRate, regions, chopOptions);
+    }), fixture.seconds);
+    segment.getDynamicObject()->setProperty("chops", static_cast<int>(chops.size()));
+    stages.add(segment);
+
+    for (auto numThreads : options.threads) {
+        auto written = 0;
+        auto result = Metrics::toVar("export-" + String{numThreads}, Metrics::repeat(options.iterations, [&]() {
+            written = Chopper::exportSourceChops(fixture.file, Crepe::sampleRate, chops, outputFolder, numThreads);
+        }), fixture.seconds);
+        result.getDynamicObject()->setProperty("threads", numThreads);
+        result.getDynamicObject()->setProperty("chops", written);
+        stages.add(result);
+    }
+
+    if (model != nullptr) {
+        auto source = readSource(fixture.file);
+        stages.add(benchStreaming(fixture, source, model, options.folder.getChildFile(fixture.name + "-streaming")));
+    }
+
+    auto* obj = new DynamicObject();
+    obj->setProperty("name", fixture.name);
+    obj->setProperty("seconds", fixture.seconds);
+    obj->setProperty("pitchSource", model != nullptr ? "crepe" : "synthetic");
+    obj->setProperty("stages", stages);
+    return var{obj};
+}
+
+auto main(int argc, char* argv[]) -> int {
+    ArgumentList args{argc, argv};
+    if (args.containsOption("--help|-h")) {
+        printUsage();
+        return 0;
+    }
+
+    BenchOptions options;
+    if (args.containsOption("--lengths")) {
+        options.lengths.clear();
+        for (auto& length : StringArray::fromTokens(args.getValueForOption("--lengths"), ",", "")) {
+            if (length.getDoubleValue() > 0.0) options.lengths.add(length.getDoubleValue());
+        }
+    }
+    if (args.containsOption("--threads")) {
+        options.threads.clear();
+        for (auto& count : StringArray::fromTokens(args.getValueForOption("--threads"), ",", "")) {
+            if (count.getIntValue() > 0) options.threads.add(count.getIntValue());
+        }
+    }
+    if (args.containsOption("--iterations")) options.iterations = jmax(1, args.getValueForOption("--iterations").getIntValue());
+    if (args.containsOption("--realtime")) options.realtimeSeconds = args.getValueForOption("--realtime").getDoubleValue();
+    options.separation = args.containsOption("--separation");
+    options.folder = File::getSpecialLocation(File::tempDirectory).getChildFile("VocalChopperBench");
+    options.folder.deleteRecursively();
+    options.folder.createDirectory();
+
+    SharedResourcePointer<PythonWorker> worker;
+    Array<var> fixtures;
+    auto startup = benchStartup(options);
+    var realtime;
+
+    for (auto length : options.lengths) {
+        auto fixture = Fixtures::create(options.folder, length);
+        std::cerr << "Benchmarking " << fixture.name << std::endl;
+        auto result = benchFixture(options, fixture, *worker);
+        if (result.isObject()) fixtures.add(result);
+
+        if (realtime.isVoid() && options.realtimeSeconds > 0.0) {
+            realtime = benchRealtime(options, readSource(fixture.file), options.folder.getChildFile(fixture.name));
+        }
+    }
+
+    auto* system = new DynamicObject();
+    system->setProperty("os", SystemStats::getOperatingSystemName());
+    system->setProperty("cpu", SystemStats::getCpuModel());
+    system->setProperty("cores", SystemStats::getNumPhysicalCpus());
+    system->setProperty("threads", SystemStats::getNumCpus());
+    system->setProperty("juce", SystemStats::getJUCEVersion());
+    #if JUCE_DEBUG
+        system->setProperty("build", "debug");
+    #else
+        system->setProperty("build", "release");
+    #endif
+
+    auto* report = new DynamicObject();
+    report->setProperty("system", var{system});
+    report->setProperty("iterations", options.iterations);
+    report->setProperty("startup", startup);
+    report->setProperty("realtime", realtime);
+    report->setProperty("fixtures", fixtures);
+
+    auto json = JSON::toString(var{report});
+    std::cout << json << std::endl;
+    if (args.containsOption("--output")) {
+        File::getCurrentWorkingDirectory().getChildFile(args.getValueForOption("--output")).replaceWithText(json);
+    }
+    if (!args.containsOption("--keep")) options.folder.deleteRecursively();
+    return fixtures.size() == options.lengths.size() ? 0 : 1;
+}
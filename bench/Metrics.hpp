@@ -0,0 +1,85 @@
+#pragma once
+#include <JuceHeader.h>
+
+#if JUCE_WINDOWS
+  #include <windows.h>
+  #include <psapi.h>
+  #pragma comment(lib, "Psapi.lib")
+#else
+  #include <sys/resource.h>
+#endif
+
+struct Measurement {
+    double wallSeconds = 0.0;
+    double cpuSeconds = 0.0;
+    int64 peakRssBytes = 0;
+};
+
+class Metrics {
+public:
+    static auto getCpuSeconds() -> double {
+        #if JUCE_WINDOWS
+            FILETIME creation, exit, kernel, user;
+            if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user)) return 0.0;
+            auto toSeconds = [](const FILETIME& time) {
+                return static_cast<double>((static_cast<uint64>(time.dwHighDateTime) << 32) | time.dwLowDateTime) / 1.0e7;
+            };
+            return toSeconds(kernel) + toSeconds(user);
+        #else
+            rusage usage{};
+            getrusage(RUSAGE_SELF, &usage);
+            auto toSeconds = [](const timeval& time) { return static_cast<double>(time.tv_sec) + time.tv_usec / 1.0e6; };
+            return toSeconds(usage.ru_utime) + toSeconds(usage.ru_stime);
+        #endif
+    }
+
+    static auto getPeakRssBytes() -> int64 {
+        #if JUCE_WINDOWS
+            PROCESS_MEMORY_COUNTERS counters{};
+            if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+            return static_cast<int64>(counters.PeakWorkingSetSize);
+        #else
+            rusage usage{};
+            getrusage(RUSAGE_SELF, &usage);
+            #if JUCE_MAC
+                return static_cast<int64>(usage.ru_maxrss);
+            #else
+                return static_cast<int64>(usage.ru_maxrss) * 1024;
+            #endif
+        #endif
+    }
+
+    static auto measure(const std::function<void()>& stage) -> Measurement {
+        auto wall = Time::getMillisecondCounterHiRes();
+        auto cpu = getCpuSeconds();
+        stage();
+        return {(Time::getMillisecondCounterHiRes() - wall) / 1000.0, getCpuSeconds() - cpu, getPeakRssBytes()};
+    }
+
+    static auto repeat(int iterations, const std::function<void()>& stage) -> Measurement {
+        std::vector<Measurement> samples;
+        for (int i = 0; i < jmax(1, iterations); i++) samples.push_back(measure(stage));
+
+        std::sort(samples.begin(), samples.end(), [](auto& a, auto& b) { return a.wallSeconds < b.wallSeconds; });
+        auto median = samples[samples.size() / 2];
+        for (auto& sample : samples) median.peakRssBytes = jmax(median.peakRssBytes, sample.peakRssBytes);
+        return median;
+    }
+
+    static auto toVar(const String& name, const Measurement& sample, double audioSeconds = 0.0) -> var {
+        auto* obj = new DynamicObject();
+        obj->setProperty("stage", name);
+        obj->setProperty("wallSeconds", sample.wallSeconds);
+        obj->setProperty("cpuSeconds", sample.cpuSeconds);
+        obj->setProperty("peakRssBytes", sample.peakRssBytes);
+        if (audioSeconds > 0.0) obj->setProperty("realtimeFactor", sample.wallSeconds > 0.0 ? audioSeconds / sample.wallSeconds : 0.0);
+        return var{obj};
+    }
+
+    static auto percentile(std::vector<double> values, double fraction) -> double {
+        if (values.empty()) return 0.0;
+        std::sort(values.begin(), values.end());
+        auto index = static_cast<size_t>(fraction * static_cast<double>(values.size() - 1));
+        return values[index];
+    }
+};
@@ -0,0 +1,162 @@
+#include <JuceHeader.h>
+#include "JobQueue.h"
+#include "Settings.hpp"
+
+class CliReporter : public JobQueue::Listener {
+public:
+    CliReporter(int expected) : expected(expected) {}
+
+    auto jobChanged(const Job& job) -> void override {
+        const ScopedLock sl{this->lock};
+        auto state = Job::stateToString(job.state);
+        auto previous = this->jobs.find(job.id);
+        auto print = previous == this->jobs.end() || previous->second.state != job.state
+            || std::abs(previous->second.progress - job.progress) >= 5.0;
+        this->jobs[job.id] = job;
+
+        if (print) {
+            auto eta = job.eta > 0.0 ? " eta " + String{job.eta, 1} + "s" : String{};
+            auto error = job.error.isNotEmpty() ? ": " + job.error : String{};
+            std::cout << "[" << job.id << "] " << job.name << " " << state << " "
+                << String{job.progress, 1} << "%" << eta << error << std::endl;
+        }
+
+        auto done = std::count_if(this->jobs.begin(), this->jobs.end(), [](auto& entry) { 
+            return !entry.second.setup && entry.second.isDone(); 
+        });
+        if (done >= this->expected) this->finished.signal();
+    }
+
+    auto getJobs() const -> std::vector<Job> {
+        const ScopedLock sl{this->lock};
+        std::vector<Job> result;
+        for (auto& entry : this->jobs) result.push_back(entry.second);
+        return result;
+    }
+
+    WaitableEvent finished{true};
+
+private:
+    mutable CriticalSection lock;
+    std::map<int, Job> jobs;
+    int expected = 0;
+};
+
+static auto printUsage() -> void {
+    std::cout << "Usage: VocalChopperCli --output <folder> [options] <files, folders or globs...>\n"
+        << "  -o, --output <folder>     Destination folder for the chop folders\n"
+        << "  --threshold <value>       Voicing confidence threshold (default 0.5)\n"
+        << "  --min-duration <seconds>  Minimum chop duration (default 0.2)\n"
+        << "  --min-rms <value>         Minimum chop RMS (default 0.01)\n"
+        << "  --skip-separation         Chop the inputs directly without extracting vocals\n"
+        << "  --keep-vocals             Keep the separated vocals.wav next to the chops\n"
+        << "  -j, --jobs <count>        Number of files processed concurrently (default 2)\n"
+        << "  --trace                   Write a Chrome trace.json of every job next to its chops\n"
+        << "  --report <file>           JSON report path (default <output>/report.json)" << std::endl;
+}
+
+static auto expandGlob(const String& pattern) -> StringArray {
+    if (!pattern.containsAnyOf("*?")) return {File::getCurrentWorkingDirectory().getChildFile(pattern).getFullPathName()};
+
+    auto path = File::getCurrentWorkingDirectory().getChildFile(pattern);
+    StringArray paths;
+    for (auto& file : path.getParentDirectory().findChildFiles(File::findFilesAndDirectories, false, path.getFileName())) {
+        paths.add(file.getFullPathName());
+    }
+    paths.sort(true);
+    return paths;
+}
+
+static auto countChops(const File& folder) -> int {
+    return folder.isDirectory() ? folder.getNumberOfChildFiles(File::findFiles, "chop*.wav") : 0;
+}
+
+auto main(int argc, char* argv[]) -> int {
+    ArgumentList args{argc, argv};
+    if (args.size() == 0 || args.containsOption("--help|-h")) {
+        printUsage();
+        return args.size() == 0 ? 1 : 0;
+    }
+
+    auto output = args.getValueForOption("--output|-o");
+    if (output.isEmpty()) {
+        std::cerr << "Missing --output folder" << std::endl;
+        printUsage();
+        return 1;
+    }
+    File destFolder = File::getCurrentWorkingDirectory().getChildFile(output);
+    destFolder.createDirectory();
+
+    Chopper::Options options;
+    if (args.containsOption("--threshold")) options.threshold = args.getValueForOption("--threshold").getFloatValue();
+    if (args.containsOption("--min-duration")) options.minDuration = args.getValueForOption("--min-duration").getDoubleValue();
+    if (args.containsOption("--min-rms")) options.minRms = args.getValueForOption("--min-rms").getDoubleValue();
+    auto skipSeparation = args.containsOption("--skip-separation");
+    auto keepVocals = args.containsOption("--keep-vocals");
+    auto jobs = args.containsOption("--jobs|-j") ? args.getValueForOption("--jobs|-j").getIntValue() : 2;
+    auto reportPath = args.getValueForOption("--report");
+    auto reportFile = reportPath.isNotEmpty() ? File::getCurrentWorkingDirectory().getChildFile(reportPath)
+        : destFolder.getChildFile("report.json");
+
+    StringArray patterns;
+    for (int i = 0; i < args.size(); i++) {
+        auto& arg = args[i];
+        if (arg.isOption()) {
+            auto takesValue = arg.isShortOption('o') || arg.isShortOption('j') || arg.isLongOption("output") || arg.isLongOption("jobs")
+                || arg.isLongOption("threshold") || arg.isLongOption("min-duration") || arg.isLongOption("min-rms") || arg.isLongOption("report");
+            if (takesValue && !arg.text.contains("=")) i++;
+            continue;
+        }
+        patterns.addArray(expandGlob(arg.text));
+    }
+
+    auto inputs = JobQueue::expandInputs(patterns);
+    if (inputs.isEmpty()) {
+        std::cerr << "No audio files found" << std::endl;
+        return 1;
+    }
+
+    SharedResourcePointer<Settings> settings;
+    SharedResourcePointer<PythonWorker> worker;
+    JobQueue queue{*worker};
+    CliReporter reporter{inputs.size()};
+    queue.setMaxConcurrentJobs(jobs);
+    queue.setKeepTraces(args.containsOption("--trace"));
+    queue.addListener(&reporter);
+
+    auto started = Time::getMillisecondCounterHiRes();
+    for (auto& input : inputs) queue.add(input, input.getFileName(), destFolder, skipSeparation, keepVocals, options);
+    reporter.finished.wait();
+    auto elapsed = (Time::getMillisecondCounterHiRes() - started) / 1000.0;
+    queue.removeListener(&reporter);
+
+    Array<var> results;
+    int succeeded = 0;
+    for (auto& job : reporter.getJobs()) {
+        if (job.setup) continue;
+        auto result = job.toVar();
+        result.getDynamicObject()->setProperty("input", job.input.getFullPathName());
+        result.getDynamicObject()->setProperty("chops", countChops(job.outputFolder));
+        result.getDynamicObject()->setProperty("seconds", (job.ended - job.started).inSeconds());
+        auto trace = job.outputFolder.getChildFile("trace.json");
+        if (job.keepTrace && trace.existsAsFile()) result.getDynamicObject()->setProperty("trace", trace.getFullPathName());
+        results.add(result);
+        if (job.state == Job::State::finished) succeeded++;
+    }
+
+    auto* report = new DynamicObject();
+    report->setProperty("destFolder", destFolder.getFullPathName());
+    report->setProperty("threshold", options.threshold);
+    report->setProperty("minDuration", options.minDuration);
+    report->setProperty("minRms", options.minRms);
+    report->setProperty("skipVocalExtraction", skipSeparation);
+    report->setProperty("seconds", elapsed);
+    report->setProperty("succeeded", succeeded);
+    report->setProperty("total", results.size());
+    report->setProperty("jobs", results);
+    reportFile.replaceWithText(JSON::toString(var{report}));
+
+    std::cout << succeeded << "/" << results.size() << " files chopped in " << String{elapsed, 1} << "s, report written to "
+        << reportFile.getFullPathName() << std::endl;
+    return succeeded == results.size() ? 0 : 1;
+}
@@ -2,87 +2,398 @@
 
 #include "BinaryData.h"
 
-static const unsigned char temp1[] = {105,109,112,111,114,116,32,115,121,115,10,105,109,112,111,114,116,32,115,117,98,112,114,111,99,101,115,115,10,105,109,112,111,114,116,32,105,109,112,111,
-  114,116,108,105,98,46,109,101,116,97,100,97,116,97,10,10,114,101,113,117,105,114,101,100,32,61,32,123,34,100,101,109,117,99,115,34,44,32,34,99,
-  114,101,112,101,34,44,32,34,108,105,98,114,111,115,97,34,44,32,34,115,111,117,110,100,102,105,108,101,34,44,32,34,116,101,110,115,111,114,102,108,
-  111,119,34,44,32,34,111,110,110,120,114,117,110,116,105,109,101,34,125,10,105,110,115,116,97,108,108,101,100,32,61,32,123,100,105,115,116,46,109,101,
-  116,97,100,97,116,97,91,34,78,97,109,101,34,93,46,108,111,119,101,114,40,41,32,102,111,114,32,100,105,115,116,32,105,110,32,105,109,112,111,114,
-  116,108,105,98,46,109,101,116,97,100,97,116,97,46,100,105,115,116,114,105,98,117,116,105,111,110,115,40,41,125,10,109,105,115,115,105,110,103,32,61,
-  32,114,101,113,117,105,114,101,100,32,45,32,105,110,115,116,97,108,108,101,100,10,10,105,102,32,109,105,115,115,105,110,103,58,10,32,32,32,32,112,
-  121,116,104,111,110,32,61,32,115,121,115,46,101,120,101,99,117,116,97,98,108,101,10,32,32,32,32,115,117,98,112,114,111,99,101,115,115,46,99,104,
-  101,99,107,95,99,97,108,108,40,91,112,121,116,104,111,110,44,32,34,45,109,34,44,32,34,112,105,112,34,44,32,34,105,110,115,116,97,108,108,34,
-  44,32,42,109,105,115,115,105,110,103,93,44,32,115,116,100,111,117,116,61,115,117,98,112,114,111,99,101,115,115,46,68,69,86,78,85,76,76,41,10,
-  10,105,109,112,111,114,116,32,97,114,103,112,97,114,115,101,10,105,109,112,111,114,116,32,99,114,101,112,101,10,105,109,112,111,114,116,32,108,105,98,
-  114,111,115,97,10,105,109,112,111,114,116,32,115,111,117,110,100,102,105,108,101,10,105,109,112,111,114,116,32,111,115,10,105,109,112,111,114,116,32,115,
-  104,117,116,105,108,10,105,109,112,111,114,116,32,100,101,109,117,99,115,46,115,101,112,97,114,97,116,101,10,10,100,101,102,32,115,101,112,97,114,97,
+static const unsigned char temp1[] = {105,109,112,111,114,116,32,115,121,115,10,105,109,112,111,114,116,32,116,105,109,101,10,105,109,112,111,114,116,32,115,117,98,112,114,111,99,101,115,115,
+  10,10,115,116,97,114,116,101,100,32,61,32,116,105,109,101,46,112,101,114,102,95,99,111,117,110,116,101,114,40,41,10,114,101,113,117,105,114,101,100,
+  32,61,32,91,34,100,101,109,117,99,115,34,44,32,34,99,114,101,112,101,34,44,32,34,108,105,98,114,111,115,97,34,44,32,34,115,111,117,110,100,
+  102,105,108,101,34,44,32,34,116,101,110,115,111,114,102,108,111,119,34,44,32,34,111,110,110,120,114,117,110,116,105,109,101,34,93,10,10,100,101,102,
+  32,112,114,111,118,105,115,105,111,110,40,41,58,10,32,32,32,32,105,109,112,111,114,116,32,106,115,111,110,10,32,32,32,32,105,109,112,111,114,116,
+  32,105,109,112,111,114,116,108,105,98,46,109,101,116,97,100,97,116,97,10,32,32,32,32,105,110,115,116,97,108,108,101,100,32,61,32,123,100,105,115,
+  116,46,109,101,116,97,100,97,116,97,91,34,78,97,109,101,34,93,46,108,111,119,101,114,40,41,32,102,111,114,32,100,105,115,116,32,105,110,32,105,
+  109,112,111,114,116,108,105,98,46,109,101,116,97,100,97,116,97,46,100,105,115,116,114,105,98,117,116,105,111,110,115,40,41,125,10,32,32,32,32,109,
+  105,115,115,105,110,103,32,61,32,91,110,97,109,101,32,102,111,114,32,110,97,109,101,32,105,110,32,114,101,113,117,105,114,101,100,32,105,102,32,110,
+  97,109,101,32,110,111,116,32,105,110,32,105,110,115,116,97,108,108,101,100,93,10,32,32,32,32,115,101,110,100,32,61,32,108,97,109,98,100,97,32,
+  109,101,115,115,97,103,101,58,32,112,114,105,110,116,40,106,115,111,110,46,100,117,109,112,115,40,109,101,115,115,97,103,101,41,44,32,102,108,117,115,
+  104,61,84,114,117,101,41,10,10,32,32,32,32,102,111,114,32,105,44,32,110,97,109,101,32,105,110,32,101,110,117,109,101,114,97,116,101,40,109,105,
+  115,115,105,110,103,41,58,10,32,32,32,32,32,32,32,32,115,101,110,100,40,123,34,116,121,112,101,34,58,32,34,112,114,111,103,114,101,115,115,34,
+  44,32,34,115,116,97,103,101,34,58,32,110,97,109,101,44,32,34,102,114,97,99,116,105,111,110,34,58,32,105,32,47,32,108,101,110,40,109,105,115,
+  115,105,110,103,41,44,32,34,101,116,97,34,58,32,45,49,46,48,44,32,34,102,114,97,109,101,115,34,58,32,105,44,32,34,116,111,116,97,108,34,
+  58,32,108,101,110,40,109,105,115,115,105,110,103,41,125,41,10,32,32,32,32,32,32,32,32,116,114,121,58,10,32,32,32,32,32,32,32,32,32,32,
+  32,32,115,117,98,112,114,111,99,101,115,115,46,99,104,101,99,107,95,99,97,108,108,40,91,115,121,115,46,101,120,101,99,117,116,97,98,108,101,44,
+  32,34,45,109,34,44,32,34,112,105,112,34,44,32,34,105,110,115,116,97,108,108,34,44,32,110,97,109,101,93,44,32,115,116,100,111,117,116,61,115,
+  117,98,112,114,111,99,101,115,115,46,68,69,86,78,85,76,76,44,32,115,116,100,101,114,114,61,115,117,98,112,114,111,99,101,115,115,46,68,69,86,
+  78,85,76,76,41,10,32,32,32,32,32,32,32,32,101,120,99,101,112,116,32,115,117,98,112,114,111,99,101,115,115,46,67,97,108,108,101,100,80,114,
+  111,99,101,115,115,69,114,114,111,114,58,10,32,32,32,32,32,32,32,32,32,32,32,32,115,101,110,100,40,123,34,116,121,112,101,34,58,32,34,101,
+  114,114,111,114,34,44,32,34,109,101,115,115,97,103,101,34,58,32,102,34,70,97,105,108,101,100,32,116,111,32,105,110,115,116,97,108,108,32,123,110,
+  97,109,101,125,34,125,41,10,32,32,32,32,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,49,10,32,32,32,32,35,32,84,104,101,32,101,
+  109,98,101,100,100,101,100,32,105,110,116,101,114,112,114,101,116,101,114,32,105,115,32,99,111,110,102,105,103,117,114,101,100,32,102,114,111,109,32,116,
+  104,101,115,101,44,32,114,101,97,100,32,116,104,101,109,32,102,114,111,109,32,97,32,102,114,101,115,104,32,112,114,111,99,101,115,115,32,115,111,32,
+  110,101,119,32,115,105,116,101,32,102,111,108,100,101,114,115,32,97,114,101,32,105,110,99,108,117,100,101,100,46,10,32,32,32,32,113,117,101,114,121,
+  32,61,32,34,105,109,112,111,114,116,32,106,115,111,110,44,32,115,121,115,59,32,112,114,105,110,116,40,106,115,111,110,46,100,117,109,112,115,40,123,
+  39,104,111,109,101,39,58,32,115,121,115,46,98,97,115,101,95,112,114,101,102,105,120,44,32,39,101,120,101,99,117,116,97,98,108,101,39,58,32,115,
+  121,115,46,101,120,101,99,117,116,97,98,108,101,44,32,39,112,97,116,104,115,39,58,32,91,112,32,102,111,114,32,112,32,105,110,32,115,121,115,46,
+  112,97,116,104,32,105,102,32,112,93,44,32,39,112,121,116,104,111,110,95,118,101,114,115,105,111,110,39,58,32,102,39,123,115,121,115,46,118,101,114,
+  115,105,111,110,95,105,110,102,111,91,48,93,125,46,123,115,121,115,46,118,101,114,115,105,111,110,95,105,110,102,111,91,49,93,125,39,125,41,41,34,
+  10,32,32,32,32,105,110,116,101,114,112,114,101,116,101,114,32,61,32,106,115,111,110,46,108,111,97,100,115,40,115,117,98,112,114,111,99,101,115,115,
+  46,99,104,101,99,107,95,111,117,116,112,117,116,40,91,115,121,115,46,101,120,101,99,117,116,97,98,108,101,44,32,34,45,99,34,44,32,113,117,101,
+  114,121,93,41,41,10,32,32,32,32,115,101,110,100,40,123,34,116,121,112,101,34,58,32,34,114,101,115,117,108,116,34,44,32,42,42,105,110,116,101,
+  114,112,114,101,116,101,114,125,41,10,32,32,32,32,114,101,116,117,114,110,32,48,10,10,105,102,32,95,95,110,97,109,101,95,95,32,61,61,32,34,
+  95,95,109,97,105,110,95,95,34,32,97,110,100,32,34,45,45,112,114,111,118,105,115,105,111,110,34,32,105,110,32,115,121,115,46,97,114,103,118,58,
+  10,32,32,32,32,115,121,115,46,101,120,105,116,40,112,114,111,118,105,115,105,111,110,40,41,41,10,10,105,109,112,111,114,116,32,97,114,103,112,97,
+  114,115,101,10,105,109,112,111,114,116,32,108,105,98,114,111,115,97,10,105,109,112,111,114,116,32,115,111,117,110,100,102,105,108,101,10,105,109,112,111,
+  114,116,32,111,115,10,105,109,112,111,114,116,32,114,101,10,105,109,112,111,114,116,32,106,115,111,110,10,105,109,112,111,114,116,32,115,116,114,117,99,
+  116,10,105,109,112,111,114,116,32,115,111,99,107,101,116,10,105,109,112,111,114,116,32,110,117,109,112,121,10,105,109,112,111,114,116,32,115,104,117,116,
+  105,108,10,105,109,112,111,114,116,32,116,104,114,101,97,100,105,110,103,10,105,109,112,111,114,116,32,99,111,110,116,101,120,116,108,105,98,10,105,109,
+  112,111,114,116,32,99,111,110,99,117,114,114,101,110,116,46,102,117,116,117,114,101,115,10,105,109,112,111,114,116,32,116,111,114,99,104,10,105,109,112,
+  111,114,116,32,100,101,109,117,99,115,46,97,112,112,108,121,10,105,109,112,111,114,116,32,100,101,109,117,99,115,46,97,117,100,105,111,10,105,109,112,
+  111,114,116,32,100,101,109,117,99,115,46,112,114,101,116,114,97,105,110,101,100,10,105,109,112,111,114,116,32,100,101,109,117,99,115,46,115,101,112,97,
+  114,97,116,101,10,10,105,109,112,111,114,116,101,100,32,61,32,116,105,109,101,46,112,101,114,102,95,99,111,117,110,116,101,114,40,41,10,10,109,111,
+  100,101,108,115,32,61,32,123,125,10,112,114,111,103,114,101,115,115,95,104,97,110,100,108,101,114,32,61,32,78,111,110,101,10,112,114,111,103,114,101,
+  115,115,95,115,116,97,114,116,115,32,61,32,123,125,10,116,114,97,99,101,95,101,118,101,110,116,115,32,61,32,78,111,110,101,10,115,116,97,114,116,
+  117,112,95,115,112,97,110,115,32,61,32,91,40,34,105,109,112,111,114,116,115,34,44,32,115,116,97,114,116,101,100,44,32,105,109,112,111,114,116,101,
+  100,41,93,10,10,100,101,102,32,116,114,97,99,101,95,101,118,101,110,116,40,110,97,109,101,58,32,115,116,114,44,32,99,97,116,101,103,111,114,121,
+  58,32,115,116,114,44,32,115,116,97,114,116,58,32,102,108,111,97,116,44,32,101,110,100,58,32,102,108,111,97,116,41,58,10,32,32,32,32,105,102,
+  32,116,114,97,99,101,95,101,118,101,110,116,115,32,105,115,32,110,111,116,32,78,111,110,101,58,10,32,32,32,32,32,32,32,32,116,114,97,99,101,
+  95,101,118,101,110,116,115,46,97,112,112,101,110,100,40,123,34,110,97,109,101,34,58,32,110,97,109,101,44,32,34,99,97,116,34,58,32,99,97,116,
+  101,103,111,114,121,44,32,34,112,104,34,58,32,34,88,34,44,32,34,116,115,34,58,32,115,116,97,114,116,32,42,32,49,101,54,44,32,34,100,117,
+  114,34,58,32,40,101,110,100,32,45,32,115,116,97,114,116,41,32,42,32,49,101,54,44,32,34,116,105,100,34,58,32,116,104,114,101,97,100,105,110,
+  103,46,103,101,116,95,110,97,116,105,118,101,95,105,100,40,41,125,41,10,10,64,99,111,110,116,101,120,116,108,105,98,46,99,111,110,116,101,120,116,
+  109,97,110,97,103,101,114,10,100,101,102,32,116,114,97,99,101,95,115,112,97,110,40,110,97,109,101,58,32,115,116,114,44,32,99,97,116,101,103,111,
+  114,121,58,32,115,116,114,61,34,99,104,111,112,112,101,114,34,41,58,10,32,32,32,32,115,116,97,114,116,32,61,32,116,105,109,101,46,112,101,114,
+  102,95,99,111,117,110,116,101,114,40,41,10,32,32,32,32,116,114,121,58,10,32,32,32,32,32,32,32,32,121,105,101,108,100,10,32,32,32,32,102,
+  105,110,97,108,108,121,58,10,32,32,32,32,32,32,32,32,116,114,97,99,101,95,101,118,101,110,116,40,110,97,109,101,44,32,99,97,116,101,103,111,
+  114,121,44,32,115,116,97,114,116,44,32,116,105,109,101,46,112,101,114,102,95,99,111,117,110,116,101,114,40,41,41,10,10,100,101,102,32,114,101,112,
+  111,114,116,95,112,114,111,103,114,101,115,115,40,115,116,97,103,101,58,32,115,116,114,44,32,100,111,110,101,58,32,105,110,116,44,32,116,111,116,97,
+  108,58,32,105,110,116,41,58,10,32,32,32,32,110,111,119,32,61,32,116,105,109,101,46,109,111,110,111,116,111,110,105,99,40,41,10,32,32,32,32,
+  105,102,32,100,111,110,101,32,61,61,32,48,58,10,32,32,32,32,32,32,32,32,112,114,111,103,114,101,115,115,95,115,116,97,114,116,115,91,115,116,
+  97,103,101,93,32,61,32,110,111,119,10,32,32,32,32,115,116,97,114,116,32,61,32,112,114,111,103,114,101,115,115,95,115,116,97,114,116,115,46,115,
+  101,116,100,101,102,97,117,108,116,40,115,116,97,103,101,44,32,110,111,119,41,10,32,32,32,32,101,108,97,112,115,101,100,32,61,32,110,111,119,32,
+  45,32,115,116,97,114,116,10,32,32,32,32,116,104,114,111,117,103,104,112,117,116,32,61,32,100,111,110,101,32,47,32,101,108,97,112,115,101,100,32,
+  105,102,32,101,108,97,112,115,101,100,32,62,32,48,32,101,108,115,101,32,48,46,48,10,32,32,32,32,101,116,97,32,61,32,40,116,111,116,97,108,
+  32,45,32,100,111,110,101,41,32,47,32,116,104,114,111,117,103,104,112,117,116,32,105,102,32,116,104,114,111,117,103,104,112,117,116,32,62,32,48,32,
+  101,108,115,101,32,45,49,46,48,10,32,32,32,32,112,114,111,103,114,101,115,115,32,61,32,123,34,115,116,97,103,101,34,58,32,115,116,97,103,101,
+  44,32,34,102,114,97,99,116,105,111,110,34,58,32,100,111,110,101,32,47,32,116,111,116,97,108,32,105,102,32,116,111,116,97,108,32,101,108,115,101,
+  32,48,46,48,44,32,34,101,116,97,34,58,32,101,116,97,44,32,34,102,114,97,109,101,115,34,58,32,100,111,110,101,44,32,34,116,111,116,97,108,
+  34,58,32,116,111,116,97,108,44,32,34,116,104,114,111,117,103,104,112,117,116,34,58,32,116,104,114,111,117,103,104,112,117,116,125,10,32,32,32,32,
+  105,102,32,100,111,110,101,32,62,61,32,116,111,116,97,108,58,10,32,32,32,32,32,32,32,32,112,114,111,103,114,101,115,115,95,115,116,97,114,116,
+  115,46,112,111,112,40,115,116,97,103,101,44,32,78,111,110,101,41,10,32,32,32,32,105,102,32,112,114,111,103,114,101,115,115,95,104,97,110,100,108,
+  101,114,58,10,32,32,32,32,32,32,32,32,112,114,111,103,114,101,115,115,95,104,97,110,100,108,101,114,40,112,114,111,103,114,101,115,115,41,10,10,
+  100,101,102,32,115,101,116,95,112,114,111,103,114,101,115,115,95,104,97,110,100,108,101,114,40,104,97,110,100,108,101,114,41,58,10,32,32,32,32,103,
+  108,111,98,97,108,32,112,114,111,103,114,101,115,115,95,104,97,110,100,108,101,114,10,32,32,32,32,112,114,111,103,114,101,115,115,95,104,97,110,100,
+  108,101,114,32,61,32,104,97,110,100,108,101,114,10,10,99,108,97,115,115,32,80,114,111,103,114,101,115,115,73,116,101,114,97,116,111,114,58,10,32,
+  32,32,32,100,101,102,32,95,95,105,110,105,116,95,95,40,115,101,108,102,44,32,115,116,97,103,101,58,32,115,116,114,41,58,10,32,32,32,32,32,
+  32,32,32,115,101,108,102,46,115,116,97,103,101,32,61,32,115,116,97,103,101,10,10,32,32,32,32,100,101,102,32,116,113,100,109,40,115,101,108,102,
+  44,32,105,116,101,114,97,98,108,101,44,32,42,42,107,119,97,114,103,115,41,58,10,32,32,32,32,32,32,32,32,105,116,101,109,115,32,61,32,108,
+  105,115,116,40,105,116,101,114,97,98,108,101,41,10,32,32,32,32,32,32,32,32,114,101,112,111,114,116,95,112,114,111,103,114,101,115,115,40,115,101,
+  108,102,46,115,116,97,103,101,44,32,48,44,32,108,101,110,40,105,116,101,109,115,41,41,10,32,32,32,32,32,32,32,32,102,111,114,32,105,44,32,
+  105,116,101,109,32,105,110,32,101,110,117,109,101,114,97,116,101,40,105,116,101,109,115,41,58,10,32,32,32,32,32,32,32,32,32,32,32,32,121,105,
+  101,108,100,32,105,116,101,109,10,32,32,32,32,32,32,32,32,32,32,32,32,114,101,112,111,114,116,95,112,114,111,103,114,101,115,115,40,115,101,108,
+  102,46,115,116,97,103,101,44,32,105,32,43,32,49,44,32,108,101,110,40,105,116,101,109,115,41,41,10,10,100,101,109,117,99,115,46,97,112,112,108,
+  121,46,116,113,100,109,32,61,32,80,114,111,103,114,101,115,115,73,116,101,114,97,116,111,114,40,34,115,101,112,97,114,97,116,105,110,103,34,41,10,
+  10,100,101,102,32,103,101,116,95,109,111,100,101,108,40,110,97,109,101,58,32,115,116,114,61,34,104,116,100,101,109,117,99,115,34,41,58,10,32,32,
+  32,32,105,102,32,110,97,109,101,32,110,111,116,32,105,110,32,109,111,100,101,108,115,58,10,32,32,32,32,32,32,32,32,119,105,116,104,32,116,114,
+  97,99,101,95,115,112,97,110,40,34,100,101,109,117,99,115,46,109,111,100,101,108,95,108,111,97,100,34,41,58,10,32,32,32,32,32,32,32,32,32,
+  32,32,32,109,111,100,101,108,32,61,32,100,101,109,117,99,115,46,112,114,101,116,114,97,105,110,101,100,46,103,101,116,95,109,111,100,101,108,40,110,
+  97,109,101,41,10,32,32,32,32,32,32,32,32,109,111,100,101,108,46,101,118,97,108,40,41,10,32,32,32,32,32,32,32,32,109,111,100,101,108,115,
+  91,110,97,109,101,93,32,61,32,109,111,100,101,108,10,32,32,32,32,114,101,116,117,114,110,32,109,111,100,101,108,115,91,110,97,109,101,93,10,10,
+  100,101,102,32,115,101,112,97,114,97,116,101,95,119,97,118,40,109,111,100,101,108,44,32,119,97,118,41,58,10,32,32,32,32,100,101,118,105,99,101,
+  32,61,32,34,99,117,100,97,34,32,105,102,32,116,111,114,99,104,46,99,117,100,97,46,105,115,95,97,118,97,105,108,97,98,108,101,40,41,32,101,
+  108,115,101,32,34,99,112,117,34,10,32,32,32,32,114,101,102,32,61,32,119,97,118,46,109,101,97,110,40,48,41,10,32,32,32,32,119,97,118,32,
+  61,32,40,119,97,118,32,45,32,114,101,102,46,109,101,97,110,40,41,41,32,47,32,114,101,102,46,115,116,100,40,41,10,10,32,32,32,32,119,105,
+  116,104,32,116,114,97,99,101,95,115,112,97,110,40,34,100,101,109,117,99,115,46,105,110,102,101,114,101,110,99,101,34,41,44,32,116,111,114,99,104,
+  46,110,111,95,103,114,97,100,40,41,58,10,32,32,32,32,32,32,32,32,115,111,117,114,99,101,115,32,61,32,100,101,109,117,99,115,46,97,112,112,
+  108,121,46,97,112,112,108,121,95,109,111,100,101,108,40,109,111,100,101,108,44,32,119,97,118,91,78,111,110,101,93,44,32,100,101,118,105,99,101,61,
+  100,101,118,105,99,101,44,32,115,112,108,105,116,61,84,114,117,101,44,32,111,118,101,114,108,97,112,61,48,46,50,53,44,32,112,114,111,103,114,101,
+  115,115,61,84,114,117,101,41,91,48,93,10,32,32,32,32,115,111,117,114,99,101,115,32,61,32,115,111,117,114,99,101,115,32,42,32,114,101,102,46,
+  115,116,100,40,41,32,43,32,114,101,102,46,109,101,97,110,40,41,10,32,32,32,32,114,101,116,117,114,110,32,115,111,117,114,99,101,115,91,109,111,
+  100,101,108,46,115,111,117,114,99,101,115,46,105,110,100,101,120,40,34,118,111,99,97,108,115,34,41,93,10,10,100,101,102,32,115,101,112,97,114,97,
   116,101,95,118,111,99,97,108,115,40,105,110,112,117,116,58,32,115,116,114,44,32,111,117,116,112,117,116,58,32,115,116,114,61,34,118,111,99,97,108,
-  115,46,119,97,118,34,41,58,10,32,32,32,32,111,117,116,112,117,116,95,100,105,114,32,61,32,111,115,46,112,97,116,104,46,100,105,114,110,97,109,
-  101,40,111,117,116,112,117,116,41,10,32,32,32,32,100,101,109,117,99,115,46,115,101,112,97,114,97,116,101,46,109,97,105,110,40,91,34,45,45,116,
-  119,111,45,115,116,101,109,115,61,118,111,99,97,108,115,34,44,32,34,45,111,34,44,32,111,117,116,112,117,116,95,100,105,114,44,32,105,110,112,117,
-  116,93,41,10,10,32,32,32,32,100,101,109,117,99,115,95,102,111,108,100,101,114,32,61,32,111,115,46,112,97,116,104,46,106,111,105,110,40,111,117,
-  116,112,117,116,95,100,105,114,44,32,34,104,116,100,101,109,117,99,115,34,41,10,32,32,32,32,100,101,115,116,95,102,111,108,100,101,114,32,61,32,
-  111,115,46,108,105,115,116,100,105,114,40,100,101,109,117,99,115,95,102,111,108,100,101,114,41,91,48,93,10,32,32,32,32,118,111,99,97,108,95,112,
-  97,116,104,32,61,32,111,115,46,112,97,116,104,46,106,111,105,110,40,100,101,109,117,99,115,95,102,111,108,100,101,114,44,32,100,101,115,116,95,102,
-  111,108,100,101,114,44,32,34,118,111,99,97,108,115,46,119,97,118,34,41,10,10,32,32,32,32,105,102,32,40,111,115,46,112,97,116,104,46,101,120,
-  105,115,116,115,40,111,117,116,112,117,116,41,41,58,10,32,32,32,32,32,32,32,32,111,115,46,114,101,109,111,118,101,40,111,117,116,112,117,116,41,
-  10,10,32,32,32,32,111,115,46,114,101,110,97,109,101,40,118,111,99,97,108,95,112,97,116,104,44,32,111,117,116,112,117,116,41,10,32,32,32,32,
-  115,104,117,116,105,108,46,114,109,116,114,101,101,40,100,101,109,117,99,115,95,102,111,108,100,101,114,41,10,32,32,32,32,114,101,116,117,114,110,32,
-  111,117,116,112,117,116,10,10,100,101,102,32,99,104,111,112,95,118,111,99,97,108,115,40,105,110,112,117,116,58,32,115,116,114,44,32,111,117,116,112,
-  117,116,58,32,115,116,114,61,34,99,104,111,112,115,34,44,32,110,97,109,101,58,32,115,116,114,61,34,34,44,32,116,104,114,101,115,104,111,108,100,
-  58,32,102,108,111,97,116,61,48,46,53,44,32,109,105,110,95,100,117,114,97,116,105,111,110,58,32,102,108,111,97,116,61,48,46,50,44,32,109,105,
-  110,95,114,109,115,58,32,102,108,111,97,116,61,48,46,48,49,41,58,10,32,32,32,32,97,117,100,105,111,44,32,115,114,32,61,32,108,105,98,114,
-  111,115,97,46,108,111,97,100,40,105,110,112,117,116,44,32,115,114,61,49,54,48,48,48,41,10,32,32,32,32,116,105,109,101,44,32,102,114,101,113,
+  115,46,119,97,118,34,44,32,109,111,100,101,108,95,110,97,109,101,58,32,115,116,114,61,34,104,116,100,101,109,117,99,115,34,41,58,10,32,32,32,
+  32,109,111,100,101,108,32,61,32,103,101,116,95,109,111,100,101,108,40,109,111,100,101,108,95,110,97,109,101,41,10,32,32,32,32,119,105,116,104,32,
+  116,114,97,99,101,95,115,112,97,110,40,34,100,101,109,117,99,115,46,108,111,97,100,95,116,114,97,99,107,34,41,58,10,32,32,32,32,32,32,32,
+  32,119,97,118,32,61,32,100,101,109,117,99,115,46,115,101,112,97,114,97,116,101,46,108,111,97,100,95,116,114,97,99,107,40,105,110,112,117,116,44,
+  32,109,111,100,101,108,46,97,117,100,105,111,95,99,104,97,110,110,101,108,115,44,32,109,111,100,101,108,46,115,97,109,112,108,101,114,97,116,101,41,
+  10,32,32,32,32,118,111,99,97,108,115,32,61,32,115,101,112,97,114,97,116,101,95,119,97,118,40,109,111,100,101,108,44,32,119,97,118,41,10,10,
+  32,32,32,32,105,102,32,40,111,115,46,112,97,116,104,46,101,120,105,115,116,115,40,111,117,116,112,117,116,41,41,58,10,32,32,32,32,32,32,32,
+  32,111,115,46,114,101,109,111,118,101,40,111,117,116,112,117,116,41,10,10,32,32,32,32,119,105,116,104,32,116,114,97,99,101,95,115,112,97,110,40,
+  34,100,101,109,117,99,115,46,119,114,105,116,101,34,41,58,10,32,32,32,32,32,32,32,32,100,101,109,117,99,115,46,97,117,100,105,111,46,115,97,
+  118,101,95,97,117,100,105,111,40,118,111,99,97,108,115,44,32,111,117,116,112,117,116,44,32,115,97,109,112,108,101,114,97,116,101,61,109,111,100,101,
+  108,46,115,97,109,112,108,101,114,97,116,101,41,10,32,32,32,32,114,101,116,117,114,110,32,111,117,116,112,117,116,10,10,100,101,102,32,115,101,112,
+  97,114,97,116,101,95,101,109,98,101,100,100,101,100,40,99,104,97,110,110,101,108,115,58,32,116,117,112,108,101,44,32,115,97,109,112,108,101,114,97,
+  116,101,58,32,102,108,111,97,116,44,32,109,111,100,101,108,95,110,97,109,101,58,32,115,116,114,44,32,112,114,111,103,114,101,115,115,41,58,10,32,
+  32,32,32,115,101,116,95,112,114,111,103,114,101,115,115,95,104,97,110,100,108,101,114,40,108,97,109,98,100,97,32,118,97,108,117,101,115,58,32,112,
+  114,111,103,114,101,115,115,40,106,115,111,110,46,100,117,109,112,115,40,118,97,108,117,101,115,41,41,41,10,32,32,32,32,116,114,121,58,10,32,32,
+  32,32,32,32,32,32,109,111,100,101,108,32,61,32,103,101,116,95,109,111,100,101,108,40,109,111,100,101,108,95,110,97,109,101,41,10,32,32,32,32,
+  32,32,32,32,97,117,100,105,111,32,61,32,110,117,109,112,121,46,115,116,97,99,107,40,91,110,117,109,112,121,46,102,114,111,109,98,117,102,102,101,
+  114,40,99,104,97,110,110,101,108,44,32,100,116,121,112,101,61,110,117,109,112,121,46,102,108,111,97,116,51,50,41,32,102,111,114,32,99,104,97,110,
+  110,101,108,32,105,110,32,99,104,97,110,110,101,108,115,93,41,10,32,32,32,32,32,32,32,32,119,97,118,32,61,32,100,101,109,117,99,115,46,97,
+  117,100,105,111,46,99,111,110,118,101,114,116,95,97,117,100,105,111,40,116,111,114,99,104,46,102,114,111,109,95,110,117,109,112,121,40,97,117,100,105,
+  111,41,44,32,105,110,116,40,115,97,109,112,108,101,114,97,116,101,41,44,32,109,111,100,101,108,46,115,97,109,112,108,101,114,97,116,101,44,32,109,
+  111,100,101,108,46,97,117,100,105,111,95,99,104,97,110,110,101,108,115,41,10,32,32,32,32,32,32,32,32,118,111,99,97,108,115,32,61,32,115,101,
+  112,97,114,97,116,101,95,119,97,118,40,109,111,100,101,108,44,32,119,97,118,41,10,32,32,32,32,32,32,32,32,118,111,99,97,108,115,32,61,32,
+  100,101,109,117,99,115,46,97,117,100,105,111,46,99,111,110,118,101,114,116,95,97,117,100,105,111,40,118,111,99,97,108,115,46,99,112,117,40,41,44,
+  32,109,111,100,101,108,46,115,97,109,112,108,101,114,97,116,101,44,32,105,110,116,40,115,97,109,112,108,101,114,97,116,101,41,44,32,108,101,110,40,
+  99,104,97,110,110,101,108,115,41,41,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,110,117,109,112,121,46,97,115,99,111,110,116,105,103,
+  117,111,117,115,97,114,114,97,121,40,118,111,99,97,108,115,46,110,117,109,112,121,40,41,44,32,100,116,121,112,101,61,110,117,109,112,121,46,102,108,
+  111,97,116,51,50,41,10,32,32,32,32,102,105,110,97,108,108,121,58,10,32,32,32,32,32,32,32,32,115,101,116,95,112,114,111,103,114,101,115,115,
+  95,104,97,110,100,108,101,114,40,78,111,110,101,41,10,10,100,101,102,32,101,120,112,111,114,116,95,99,114,101,112,101,40,111,117,116,112,117,116,58,
+  32,115,116,114,44,32,99,97,112,97,99,105,116,121,58,32,115,116,114,61,34,102,117,108,108,34,44,32,112,114,101,99,105,115,105,111,110,58,32,115,
+  116,114,61,34,102,50,34,41,58,10,32,32,32,32,105,109,112,111,114,116,32,99,114,101,112,101,46,99,111,114,101,10,32,32,32,32,109,111,100,101,
+  108,32,61,32,99,114,101,112,101,46,99,111,114,101,46,98,117,105,108,100,95,97,110,100,95,108,111,97,100,95,109,111,100,101,108,40,99,97,112,97,
+  99,105,116,121,41,10,32,32,32,32,111,115,46,109,97,107,101,100,105,114,115,40,111,115,46,112,97,116,104,46,100,105,114,110,97,109,101,40,111,115,
+  46,112,97,116,104,46,97,98,115,112,97,116,104,40,111,117,116,112,117,116,41,41,44,32,101,120,105,115,116,95,111,107,61,84,114,117,101,41,10,32,
+  32,32,32,100,116,121,112,101,32,61,32,34,60,102,52,34,32,105,102,32,112,114,101,99,105,115,105,111,110,32,61,61,32,34,102,52,34,32,101,108,
+  115,101,32,34,60,102,50,34,10,10,32,32,32,32,119,105,116,104,32,111,112,101,110,40,111,117,116,112,117,116,32,43,32,34,46,112,97,114,116,34,
+  44,32,34,119,98,34,41,32,97,115,32,102,105,108,101,58,10,32,32,32,32,32,32,32,32,102,105,108,101,46,119,114,105,116,101,40,98,34,67,82,
+  69,80,34,41,10,32,32,32,32,32,32,32,32,102,105,108,101,46,119,114,105,116,101,40,115,116,114,117,99,116,46,112,97,99,107,40,34,60,105,105,
+  34,44,32,50,32,105,102,32,100,116,121,112,101,32,61,61,32,34,60,102,52,34,32,101,108,115,101,32,49,44,32,54,41,41,10,32,32,32,32,32,
+  32,32,32,102,111,114,32,108,32,105,110,32,114,97,110,103,101,40,49,44,32,55,41,58,10,32,32,32,32,32,32,32,32,32,32,32,32,99,111,110,
+  118,32,61,32,109,111,100,101,108,46,103,101,116,95,108,97,121,101,114,40,102,34,99,111,110,118,123,108,125,34,41,10,32,32,32,32,32,32,32,32,
+  32,32,32,32,110,111,114,109,32,61,32,109,111,100,101,108,46,103,101,116,95,108,97,121,101,114,40,102,34,99,111,110,118,123,108,125,45,66,78,34,
+  41,10,32,32,32,32,32,32,32,32,32,32,32,32,107,101,114,110,101,108,44,32,98,105,97,115,32,61,32,99,111,110,118,46,103,101,116,95,119,101,
+  105,103,104,116,115,40,41,10,32,32,32,32,32,32,32,32,32,32,32,32,103,97,109,109,97,44,32,98,101,116,97,44,32,109,101,97,110,44,32,118,
+  97,114,105,97,110,99,101,32,61,32,110,111,114,109,46,103,101,116,95,119,101,105,103,104,116,115,40,41,10,32,32,32,32,32,32,32,32,32,32,32,
+  32,115,99,97,108,101,32,61,32,103,97,109,109,97,32,47,32,110,117,109,112,121,46,115,113,114,116,40,118,97,114,105,97,110,99,101,32,43,32,110,
+  111,114,109,46,101,112,115,105,108,111,110,41,10,32,32,32,32,32,32,32,32,32,32,32,32,115,104,105,102,116,32,61,32,98,101,116,97,32,45,32,
+  109,101,97,110,32,42,32,115,99,97,108,101,10,10,32,32,32,32,32,32,32,32,32,32,32,32,119,101,105,103,104,116,115,32,61,32,107,101,114,110,
+  101,108,91,58,44,32,48,44,32,58,44,32,58,93,46,116,114,97,110,115,112,111,115,101,40,50,44,32,49,44,32,48,41,10,32,32,32,32,32,32,
+  32,32,32,32,32,32,102,105,108,101,46,119,114,105,116,101,40,115,116,114,117,99,116,46,112,97,99,107,40,34,60,105,105,105,105,34,44,32,119,101,
+  105,103,104,116,115,46,115,104,97,112,101,91,48,93,44,32,119,101,105,103,104,116,115,46,115,104,97,112,101,91,49,93,44,32,119,101,105,103,104,116,
+  115,46,115,104,97,112,101,91,50,93,44,32,99,111,110,118,46,115,116,114,105,100,101,115,91,48,93,41,41,10,32,32,32,32,32,32,32,32,32,32,
+  32,32,102,105,108,101,46,119,114,105,116,101,40,119,101,105,103,104,116,115,46,97,115,116,121,112,101,40,100,116,121,112,101,41,46,116,111,98,121,116,
+  101,115,40,41,41,10,32,32,32,32,32,32,32,32,32,32,32,32,102,111,114,32,118,97,108,117,101,115,32,105,110,32,40,98,105,97,115,44,32,115,
+  99,97,108,101,44,32,115,104,105,102,116,41,58,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,105,108,101,46,119,114,105,116,101,
+  40,118,97,108,117,101,115,46,97,115,116,121,112,101,40,34,60,102,52,34,41,46,116,111,98,121,116,101,115,40,41,41,10,10,32,32,32,32,32,32,
+  32,32,107,101,114,110,101,108,44,32,98,105,97,115,32,61,32,109,111,100,101,108,46,103,101,116,95,108,97,121,101,114,40,34,99,108,97,115,115,105,
+  102,105,101,114,34,41,46,103,101,116,95,119,101,105,103,104,116,115,40,41,10,32,32,32,32,32,32,32,32,102,105,108,101,46,119,114,105,116,101,40,
+  115,116,114,117,99,116,46,112,97,99,107,40,34,60,105,105,34,44,32,107,101,114,110,101,108,46,115,104,97,112,101,91,49,93,44,32,107,101,114,110,
+  101,108,46,115,104,97,112,101,91,48,93,41,41,10,32,32,32,32,32,32,32,32,102,105,108,101,46,119,114,105,116,101,40,107,101,114,110,101,108,46,
+  84,46,97,115,116,121,112,101,40,100,116,121,112,101,41,46,116,111,98,121,116,101,115,40,41,41,10,32,32,32,32,32,32,32,32,102,105,108,101,46,
+  119,114,105,116,101,40,98,105,97,115,46,97,115,116,121,112,101,40,34,60,102,52,34,41,46,116,111,98,121,116,101,115,40,41,41,10,10,32,32,32,
+  32,111,115,46,114,101,112,108,97,99,101,40,111,117,116,112,117,116,32,43,32,34,46,112,97,114,116,34,44,32,111,117,116,112,117,116,41,10,32,32,
+  32,32,114,101,116,117,114,110,32,111,117,116,112,117,116,10,10,100,101,102,32,103,101,116,95,99,114,101,112,101,40,99,97,112,97,99,105,116,121,58,
+  32,115,116,114,61,34,102,117,108,108,34,41,58,10,32,32,32,32,105,109,112,111,114,116,32,99,114,101,112,101,46,99,111,114,101,10,32,32,32,32,
+  105,109,112,111,114,116,32,116,101,110,115,111,114,102,108,111,119,10,32,32,32,32,109,111,100,101,108,32,61,32,99,114,101,112,101,46,99,111,114,101,
+  46,98,117,105,108,100,95,97,110,100,95,108,111,97,100,95,109,111,100,101,108,40,99,97,112,97,99,105,116,121,41,10,32,32,32,32,105,102,32,110,
+  111,116,32,103,101,116,97,116,116,114,40,109,111,100,101,108,44,32,34,114,101,112,111,114,116,115,95,112,114,111,103,114,101,115,115,34,44,32,70,97,
+  108,115,101,41,58,10,32,32,32,32,32,32,32,32,99,108,97,115,115,32,80,105,116,99,104,80,114,111,103,114,101,115,115,40,116,101,110,115,111,114,
+  102,108,111,119,46,107,101,114,97,115,46,99,97,108,108,98,97,99,107,115,46,67,97,108,108,98,97,99,107,41,58,10,32,32,32,32,32,32,32,32,
+  32,32,32,32,100,101,102,32,111,110,95,112,114,101,100,105,99,116,95,98,97,116,99,104,95,101,110,100,40,115,101,108,102,44,32,98,97,116,99,104,
+  44,32,108,111,103,115,61,78,111,110,101,41,58,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,101,112,111,114,116,95,112,114,111,
+  103,114,101,115,115,40,34,99,104,111,112,112,105,110,103,34,44,32,98,97,116,99,104,32,43,32,49,44,32,115,101,108,102,46,112,97,114,97,109,115,
+  46,103,101,116,40,34,115,116,101,112,115,34,41,32,111,114,32,98,97,116,99,104,32,43,32,49,41,10,10,32,32,32,32,32,32,32,32,112,114,101,
+  100,105,99,116,32,61,32,109,111,100,101,108,46,112,114,101,100,105,99,116,10,32,32,32,32,32,32,32,32,109,111,100,101,108,46,112,114,101,100,105,
+  99,116,32,61,32,108,97,109,98,100,97,32,42,97,114,103,115,44,32,42,42,107,119,97,114,103,115,58,32,112,114,101,100,105,99,116,40,42,97,114,
+  103,115,44,32,99,97,108,108,98,97,99,107,115,61,91,80,105,116,99,104,80,114,111,103,114,101,115,115,40,41,93,44,32,42,42,107,119,97,114,103,
+  115,41,10,32,32,32,32,32,32,32,32,109,111,100,101,108,46,114,101,112,111,114,116,115,95,112,114,111,103,114,101,115,115,32,61,32,84,114,117,101,
+  10,32,32,32,32,114,101,116,117,114,110,32,109,111,100,101,108,10,10,100,101,102,32,108,111,97,100,95,102,114,97,109,101,115,40,112,97,116,104,58,
+  32,115,116,114,41,58,10,32,32,32,32,119,105,116,104,32,111,112,101,110,40,112,97,116,104,44,32,34,114,98,34,41,32,97,115,32,102,105,108,101,
+  58,10,32,32,32,32,32,32,32,32,109,97,103,105,99,44,32,118,101,114,115,105,111,110,44,32,99,111,117,110,116,32,61,32,115,116,114,117,99,116,
+  46,117,110,112,97,99,107,40,34,60,52,115,105,105,34,44,32,102,105,108,101,46,114,101,97,100,40,49,50,41,41,10,32,32,32,32,32,32,32,32,
+  105,102,32,109,97,103,105,99,32,33,61,32,98,34,86,67,80,70,34,32,111,114,32,118,101,114,115,105,111,110,32,33,61,32,49,58,10,32,32,32,
+  32,32,32,32,32,32,32,32,32,114,97,105,115,101,32,86,97,108,117,101,69,114,114,111,114,40,102,34,73,110,118,97,108,105,100,32,102,114,97,109,
+  101,115,32,102,105,108,101,32,123,112,97,116,104,125,34,41,10,32,32,32,32,32,32,32,32,100,97,116,97,32,61,32,110,117,109,112,121,46,102,114,
+  111,109,98,117,102,102,101,114,40,102,105,108,101,46,114,101,97,100,40,99,111,117,110,116,32,42,32,49,50,41,44,32,100,116,121,112,101,61,34,60,
+  102,52,34,41,46,114,101,115,104,97,112,101,40,51,44,32,99,111,117,110,116,41,10,32,32,32,32,114,101,116,117,114,110,32,100,97,116,97,91,48,
+  93,44,32,100,97,116,97,91,49,93,44,32,100,97,116,97,91,50,93,10,10,100,101,102,32,99,104,111,112,95,118,111,99,97,108,115,40,105,110,112,
+  117,116,58,32,115,116,114,44,32,111,117,116,112,117,116,58,32,115,116,114,61,34,99,104,111,112,115,34,44,32,110,97,109,101,58,32,115,116,114,61,
+  34,34,44,32,116,104,114,101,115,104,111,108,100,58,32,102,108,111,97,116,61,48,46,53,44,32,109,105,110,95,100,117,114,97,116,105,111,110,58,32,
+  102,108,111,97,116,61,48,46,50,44,32,109,105,110,95,114,109,115,58,32,102,108,111,97,116,61,48,46,48,49,44,32,102,114,97,109,101,115,58,32,
+  115,116,114,61,78,111,110,101,44,32,116,104,114,101,97,100,115,58,32,105,110,116,61,48,44,32,102,111,108,100,101,114,58,32,115,116,114,61,78,111,
+  110,101,41,58,10,32,32,32,32,119,105,116,104,32,116,114,97,99,101,95,115,112,97,110,40,34,97,117,100,105,111,46,108,111,97,100,34,41,58,10,
+  32,32,32,32,32,32,32,32,97,117,100,105,111,44,32,115,114,32,61,32,108,105,98,114,111,115,97,46,108,111,97,100,40,105,110,112,117,116,44,32,
+  115,114,61,49,54,48,48,48,41,10,32,32,32,32,105,102,32,102,114,97,109,101,115,58,10,32,32,32,32,32,32,32,32,119,105,116,104,32,116,114,
+  97,99,101,95,115,112,97,110,40,34,102,114,97,109,101,115,46,108,111,97,100,34,41,58,10,32,32,32,32,32,32,32,32,32,32,32,32,116,105,109,
+  101,44,32,102,114,101,113,44,32,99,111,110,102,32,61,32,108,111,97,100,95,102,114,97,109,101,115,40,102,114,97,109,101,115,41,10,32,32,32,32,
+  101,108,115,101,58,10,32,32,32,32,32,32,32,32,105,109,112,111,114,116,32,99,114,101,112,101,10,32,32,32,32,32,32,32,32,119,105,116,104,32,
+  116,114,97,99,101,95,115,112,97,110,40,34,99,114,101,112,101,46,109,111,100,101,108,95,108,111,97,100,34,41,58,10,32,32,32,32,32,32,32,32,
+  32,32,32,32,103,101,116,95,99,114,101,112,101,40,41,10,32,32,32,32,32,32,32,32,119,105,116,104,32,116,114,97,99,101,95,115,112,97,110,40,
+  34,99,114,101,112,101,46,112,114,101,100,105,99,116,34,41,58,10,32,32,32,32,32,32,32,32,32,32,32,32,116,105,109,101,44,32,102,114,101,113,
   44,32,99,111,110,102,44,32,97,99,116,32,61,32,99,114,101,112,101,46,112,114,101,100,105,99,116,40,97,117,100,105,111,44,32,115,114,44,32,118,
-  105,116,101,114,98,105,61,84,114,117,101,41,10,10,32,32,32,32,118,111,105,99,101,100,32,61,32,91,105,32,102,111,114,32,105,44,32,99,32,105,
-  110,32,101,110,117,109,101,114,97,116,101,40,99,111,110,102,41,32,105,102,32,99,32,62,32,116,104,114,101,115,104,111,108,100,93,10,32,32,32,32,
-  116,111,95,115,97,109,112,108,101,115,32,61,32,108,97,109,98,100,97,32,102,114,97,109,101,58,32,105,110,116,40,102,114,97,109,101,32,42,32,48,
-  46,48,49,32,42,32,115,114,41,10,10,32,32,32,32,114,101,103,105,111,110,115,32,61,32,91,93,10,32,32,32,32,105,102,32,118,111,105,99,101,
-  100,58,10,32,32,32,32,32,32,32,32,115,116,97,114,116,32,61,32,118,111,105,99,101,100,91,48,93,10,32,32,32,32,32,32,32,32,101,110,100,
-  32,61,32,115,116,97,114,116,10,32,32,32,32,32,32,32,32,102,111,114,32,102,114,97,109,101,32,105,110,32,118,111,105,99,101,100,91,49,58,93,
-  58,10,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,102,114,97,109,101,32,45,32,101,110,100,32,62,32,51,58,10,32,32,32,32,32,32,
-  32,32,32,32,32,32,32,32,32,32,114,101,103,105,111,110,115,46,97,112,112,101,110,100,40,40,116,111,95,115,97,109,112,108,101,115,40,115,116,97,
-  114,116,41,44,32,116,111,95,115,97,109,112,108,101,115,40,101,110,100,41,41,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,
-  116,97,114,116,32,61,32,102,114,97,109,101,10,32,32,32,32,32,32,32,32,32,32,32,32,101,110,100,32,61,32,102,114,97,109,101,10,32,32,32,
-  32,32,32,32,32,114,101,103,105,111,110,115,46,97,112,112,101,110,100,40,40,116,111,95,115,97,109,112,108,101,115,40,115,116,97,114,116,41,44,32,
-  116,111,95,115,97,109,112,108,101,115,40,101,110,100,41,41,41,10,10,32,32,32,32,111,117,116,112,117,116,95,98,97,115,101,110,97,109,101,32,61,
-  32,111,115,46,112,97,116,104,46,115,112,108,105,116,101,120,116,40,111,115,46,112,97,116,104,46,98,97,115,101,110,97,109,101,40,110,97,109,101,32,
-  105,102,32,110,97,109,101,32,101,108,115,101,32,105,110,112,117,116,41,41,91,48,93,10,32,32,32,32,111,117,116,112,117,116,95,100,105,114,32,61,
-  32,111,115,46,112,97,116,104,46,106,111,105,110,40,111,117,116,112,117,116,44,32,102,34,123,111,117,116,112,117,116,95,98,97,115,101,110,97,109,101,
-  125,32,99,104,111,112,115,34,41,10,10,32,32,32,32,105,102,32,111,115,46,112,97,116,104,46,101,120,105,115,116,115,40,111,117,116,112,117,116,95,
-  100,105,114,41,58,10,32,32,32,32,32,32,32,32,115,104,117,116,105,108,46,114,109,116,114,101,101,40,111,117,116,112,117,116,95,100,105,114,41,10,
-  10,32,32,32,32,111,115,46,109,97,107,101,100,105,114,115,40,111,117,116,112,117,116,95,100,105,114,44,32,101,120,105,115,116,95,111,107,61,84,114,
-  117,101,41,10,32,32,32,32,102,111,114,32,105,44,32,40,115,116,97,114,116,44,32,101,110,100,41,32,105,110,32,101,110,117,109,101,114,97,116,101,
-  40,114,101,103,105,111,110,115,41,58,10,32,32,32,32,32,32,32,32,99,104,111,112,32,61,32,97,117,100,105,111,91,115,116,97,114,116,58,101,110,
-  100,93,10,10,32,32,32,32,32,32,32,32,105,102,32,108,101,110,40,99,104,111,112,41,32,60,32,105,110,116,40,109,105,110,95,100,117,114,97,116,
-  105,111,110,32,42,32,115,114,41,58,10,32,32,32,32,32,32,32,32,32,32,32,32,99,111,110,116,105,110,117,101,10,10,32,32,32,32,32,32,32,
-  32,114,109,115,32,61,32,108,105,98,114,111,115,97,46,102,101,97,116,117,114,101,46,114,109,115,40,121,61,99,104,111,112,41,46,109,101,97,110,40,
-  41,10,32,32,32,32,32,32,32,32,105,102,32,114,109,115,32,60,32,109,105,110,95,114,109,115,58,10,32,32,32,32,32,32,32,32,32,32,32,32,
-  99,111,110,116,105,110,117,101,10,10,32,32,32,32,32,32,32,32,116,114,105,109,44,32,95,32,61,32,108,105,98,114,111,115,97,46,101,102,102,101,
-  99,116,115,46,116,114,105,109,40,99,104,111,112,41,10,10,32,32,32,32,32,32,32,32,115,111,117,110,100,102,105,108,101,46,119,114,105,116,101,40,
-  111,115,46,112,97,116,104,46,106,111,105,110,40,111,117,116,112,117,116,95,100,105,114,44,32,102,34,99,104,111,112,123,105,125,46,119,97,118,34,41,
-  44,32,116,114,105,109,44,32,115,114,41,10,32,32,32,32,114,101,116,117,114,110,32,111,117,116,112,117,116,95,100,105,114,10,10,105,102,32,95,95,
-  110,97,109,101,95,95,32,61,61,32,34,95,95,109,97,105,110,95,95,34,58,10,32,32,32,32,112,97,114,115,101,114,32,61,32,97,114,103,112,97,
-  114,115,101,46,65,114,103,117,109,101,110,116,80,97,114,115,101,114,40,100,101,115,99,114,105,112,116,105,111,110,61,34,86,111,99,97,108,32,67,104,
-  111,112,112,101,114,34,41,10,10,32,32,32,32,103,114,111,117,112,32,61,32,112,97,114,115,101,114,46,97,100,100,95,109,117,116,117,97,108,108,121,
-  95,101,120,99,108,117,115,105,118,101,95,103,114,111,117,112,40,114,101,113,117,105,114,101,100,61,84,114,117,101,41,10,32,32,32,32,103,114,111,117,
-  112,46,97,100,100,95,97,114,103,117,109,101,110,116,40,34,45,45,115,101,112,97,114,97,116,101,34,44,32,97,99,116,105,111,110,61,34,115,116,111,
-  114,101,95,116,114,117,101,34,41,10,32,32,32,32,103,114,111,117,112,46,97,100,100,95,97,114,103,117,109,101,110,116,40,34,45,45,99,104,111,112,
-  34,44,32,97,99,116,105,111,110,61,34,115,116,111,114,101,95,116,114,117,101,34,41,10,10,32,32,32,32,112,97,114,115,101,114,46,97,100,100,95,
-  97,114,103,117,109,101,110,116,40,34,45,105,34,44,32,34,45,45,105,110,112,117,116,34,41,10,32,32,32,32,112,97,114,115,101,114,46,97,100,100,
-  95,97,114,103,117,109,101,110,116,40,34,45,111,34,44,32,34,45,45,111,117,116,112,117,116,34,41,10,32,32,32,32,112,97,114,115,101,114,46,97,
-  100,100,95,97,114,103,117,109,101,110,116,40,34,45,110,34,44,32,34,45,45,110,97,109,101,34,41,10,10,32,32,32,32,112,97,114,115,101,114,46,
-  97,100,100,95,97,114,103,117,109,101,110,116,40,34,45,45,116,104,114,101,115,104,111,108,100,34,44,32,116,121,112,101,61,102,108,111,97,116,44,32,
-  100,101,102,97,117,108,116,61,48,46,53,41,10,32,32,32,32,112,97,114,115,101,114,46,97,100,100,95,97,114,103,117,109,101,110,116,40,34,45,45,
-  109,105,110,45,100,117,114,97,116,105,111,110,34,44,32,116,121,112,101,61,102,108,111,97,116,44,32,100,101,102,97,117,108,116,61,48,46,50,41,10,
-  32,32,32,32,112,97,114,115,101,114,46,97,100,100,95,97,114,103,117,109,101,110,116,40,34,45,45,109,105,110,45,114,109,115,34,44,32,116,121,112,
-  101,61,102,108,111,97,116,44,32,100,101,102,97,117,108,116,61,48,46,48,49,41,10,10,32,32,32,32,97,114,103,115,32,61,32,112,97,114,115,101,
-  114,46,112,97,114,115,101,95,97,114,103,115,40,41,10,10,32,32,32,32,105,102,32,97,114,103,115,46,115,101,112,97,114,97,116,101,58,10,32,32,
-  32,32,32,32,32,32,111,117,116,112,117,116,32,61,32,115,101,112,97,114,97,116,101,95,118,111,99,97,108,115,40,97,114,103,115,46,105,110,112,117,
-  116,44,32,97,114,103,115,46,111,117,116,112,117,116,41,10,32,32,32,32,32,32,32,32,112,114,105,110,116,40,111,117,116,112,117,116,41,10,32,32,
-  32,32,101,108,105,102,32,97,114,103,115,46,99,104,111,112,58,10,32,32,32,32,32,32,32,32,111,117,116,112,117,116,32,61,32,99,104,111,112,95,
-  118,111,99,97,108,115,40,97,114,103,115,46,105,110,112,117,116,44,32,97,114,103,115,46,111,117,116,112,117,116,44,32,97,114,103,115,46,110,97,109,
-  101,44,32,97,114,103,115,46,116,104,114,101,115,104,111,108,100,44,32,97,114,103,115,46,109,105,110,95,100,117,114,97,116,105,111,110,44,32,97,114,
-  103,115,46,109,105,110,95,114,109,115,41,10,32,32,32,32,32,32,32,32,112,114,105,110,116,40,111,117,116,112,117,116,41,0,0};
+  105,116,101,114,98,105,61,84,114,117,101,44,32,118,101,114,98,111,115,101,61,48,41,10,10,32,32,32,32,118,111,105,99,101,100,32,61,32,91,105,
+  32,102,111,114,32,105,44,32,99,32,105,110,32,101,110,117,109,101,114,97,116,101,40,99,111,110,102,41,32,105,102,32,99,32,62,32,116,104,114,101,
+  115,104,111,108,100,93,10,32,32,32,32,116,111,95,115,97,109,112,108,101,115,32,61,32,108,97,109,98,100,97,32,102,114,97,109,101,58,32,105,110,
+  116,40,102,114,97,109,101,32,42,32,48,46,48,49,32,42,32,115,114,41,10,10,32,32,32,32,114,101,103,105,111,110,115,32,61,32,91,93,10,32,
+  32,32,32,105,102,32,118,111,105,99,101,100,58,10,32,32,32,32,32,32,32,32,115,116,97,114,116,32,61,32,118,111,105,99,101,100,91,48,93,10,
+  32,32,32,32,32,32,32,32,101,110,100,32,61,32,115,116,97,114,116,10,32,32,32,32,32,32,32,32,102,111,114,32,102,114,97,109,101,32,105,110,
+  32,118,111,105,99,101,100,91,49,58,93,58,10,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,102,114,97,109,101,32,45,32,101,110,100,32,
+  62,32,51,58,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,101,103,105,111,110,115,46,97,112,112,101,110,100,40,40,116,111,95,
+  115,97,109,112,108,101,115,40,115,116,97,114,116,41,44,32,116,111,95,115,97,109,112,108,101,115,40,101,110,100,41,41,41,10,32,32,32,32,32,32,
+  32,32,32,32,32,32,32,32,32,32,115,116,97,114,116,32,61,32,102,114,97,109,101,10,32,32,32,32,32,32,32,32,32,32,32,32,101,110,100,32,
+  61,32,102,114,97,109,101,10,32,32,32,32,32,32,32,32,114,101,103,105,111,110,115,46,97,112,112,101,110,100,40,40,116,111,95,115,97,109,112,108,
+  101,115,40,115,116,97,114,116,41,44,32,116,111,95,115,97,109,112,108,101,115,40,101,110,100,41,41,41,10,10,32,32,32,32,111,117,116,112,117,116,
+  95,98,97,115,101,110,97,109,101,32,61,32,111,115,46,112,97,116,104,46,115,112,108,105,116,101,120,116,40,111,115,46,112,97,116,104,46,98,97,115,
+  101,110,97,109,101,40,110,97,109,101,32,105,102,32,110,97,109,101,32,101,108,115,101,32,105,110,112,117,116,41,41,91,48,93,10,32,32,32,32,111,
+  117,116,112,117,116,95,100,105,114,32,61,32,102,111,108,100,101,114,32,105,102,32,102,111,108,100,101,114,32,101,108,115,101,32,111,115,46,112,97,116,
+  104,46,106,111,105,110,40,111,117,116,112,117,116,44,32,102,34,123,111,117,116,112,117,116,95,98,97,115,101,110,97,109,101,125,32,99,104,111,112,115,
+  34,41,10,10,32,32,32,32,105,102,32,111,115,46,112,97,116,104,46,101,120,105,115,116,115,40,111,117,116,112,117,116,95,100,105,114,41,58,10,32,
+  32,32,32,32,32,32,32,115,104,117,116,105,108,46,114,109,116,114,101,101,40,111,117,116,112,117,116,95,100,105,114,41,10,10,32,32,32,32,111,115,
+  46,109,97,107,101,100,105,114,115,40,111,117,116,112,117,116,95,100,105,114,44,32,101,120,105,115,116,95,111,107,61,84,114,117,101,41,10,32,32,32,
+  32,105,110,102,111,32,61,32,115,111,117,110,100,102,105,108,101,46,105,110,102,111,40,105,110,112,117,116,41,10,32,32,32,32,114,97,116,105,111,32,
+  61,32,105,110,102,111,46,115,97,109,112,108,101,114,97,116,101,32,47,32,115,114,10,32,32,32,32,115,117,98,116,121,112,101,32,61,32,105,110,102,
+  111,46,115,117,98,116,121,112,101,32,105,102,32,105,110,102,111,46,115,117,98,116,121,112,101,32,105,110,32,40,34,80,67,77,95,49,54,34,44,32,
+  34,80,67,77,95,50,52,34,41,32,101,108,115,101,32,34,80,67,77,95,50,52,34,10,10,32,32,32,32,108,111,99,97,108,32,61,32,116,104,114,
+  101,97,100,105,110,103,46,108,111,99,97,108,40,41,10,10,32,32,32,32,100,101,102,32,101,120,112,111,114,116,95,99,104,111,112,40,105,58,32,105,
+  110,116,44,32,115,116,97,114,116,58,32,105,110,116,44,32,101,110,100,58,32,105,110,116,41,58,10,32,32,32,32,32,32,32,32,119,105,116,104,32,
+  116,114,97,99,101,95,115,112,97,110,40,102,34,99,104,111,112,123,105,125,34,44,32,34,101,120,112,111,114,116,34,41,58,10,32,32,32,32,32,32,
+  32,32,32,32,32,32,114,101,116,117,114,110,32,119,114,105,116,101,95,99,104,111,112,40,105,44,32,115,116,97,114,116,44,32,101,110,100,41,10,10,
+  32,32,32,32,100,101,102,32,119,114,105,116,101,95,99,104,111,112,40,105,58,32,105,110,116,44,32,115,116,97,114,116,58,32,105,110,116,44,32,101,
+  110,100,58,32,105,110,116,41,58,10,32,32,32,32,32,32,32,32,99,104,111,112,32,61,32,97,117,100,105,111,91,115,116,97,114,116,58,101,110,100,
+  93,10,10,32,32,32,32,32,32,32,32,105,102,32,108,101,110,40,99,104,111,112,41,32,60,32,105,110,116,40,109,105,110,95,100,117,114,97,116,105,
+  111,110,32,42,32,115,114,41,58,10,32,32,32,32,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,70,97,108,115,101,10,10,32,32,32,32,
+  32,32,32,32,114,109,115,32,61,32,108,105,98,114,111,115,97,46,102,101,97,116,117,114,101,46,114,109,115,40,121,61,99,104,111,112,41,46,109,101,
+  97,110,40,41,10,32,32,32,32,32,32,32,32,105,102,32,114,109,115,32,60,32,109,105,110,95,114,109,115,58,10,32,32,32,32,32,32,32,32,32,
+  32,32,32,114,101,116,117,114,110,32,70,97,108,115,101,10,10,32,32,32,32,32,32,32,32,95,44,32,40,116,114,105,109,95,115,116,97,114,116,44,
+  32,116,114,105,109,95,101,110,100,41,32,61,32,108,105,98,114,111,115,97,46,101,102,102,101,99,116,115,46,116,114,105,109,40,99,104,111,112,41,10,
+  32,32,32,32,32,32,32,32,115,111,117,114,99,101,95,115,116,97,114,116,32,61,32,114,111,117,110,100,40,40,115,116,97,114,116,32,43,32,116,114,
+  105,109,95,115,116,97,114,116,41,32,42,32,114,97,116,105,111,41,10,32,32,32,32,32,32,32,32,115,111,117,114,99,101,95,101,110,100,32,61,32,
+  109,105,110,40,105,110,102,111,46,102,114,97,109,101,115,44,32,114,111,117,110,100,40,40,115,116,97,114,116,32,43,32,116,114,105,109,95,101,110,100,
+  41,32,42,32,114,97,116,105,111,41,41,10,10,32,32,32,32,32,32,32,32,105,102,32,110,111,116,32,104,97,115,97,116,116,114,40,108,111,99,97,
+  108,44,32,34,115,111,117,114,99,101,34,41,58,10,32,32,32,32,32,32,32,32,32,32,32,32,108,111,99,97,108,46,115,111,117,114,99,101,32,61,
+  32,115,111,117,110,100,102,105,108,101,46,83,111,117,110,100,70,105,108,101,40,105,110,112,117,116,41,10,32,32,32,32,32,32,32,32,108,111,99,97,
+  108,46,115,111,117,114,99,101,46,115,101,101,107,40,115,111,117,114,99,101,95,115,116,97,114,116,41,10,32,32,32,32,32,32,32,32,100,97,116,97,
+  32,61,32,108,111,99,97,108,46,115,111,117,114,99,101,46,114,101,97,100,40,115,111,117,114,99,101,95,101,110,100,32,45,32,115,111,117,114,99,101,
+  95,115,116,97,114,116,44,32,97,108,119,97,121,115,95,50,100,61,84,114,117,101,41,10,10,32,32,32,32,32,32,32,32,115,111,117,110,100,102,105,
+  108,101,46,119,114,105,116,101,40,111,115,46,112,97,116,104,46,106,111,105,110,40,111,117,116,112,117,116,95,100,105,114,44,32,102,34,99,104,111,112,
+  123,105,125,46,119,97,118,34,41,44,32,100,97,116,97,44,32,105,110,102,111,46,115,97,109,112,108,101,114,97,116,101,44,32,115,117,98,116,121,112,
+  101,61,115,117,98,116,121,112,101,41,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,84,114,117,101,10,10,32,32,32,32,119,111,114,107,
+  101,114,115,32,61,32,116,104,114,101,97,100,115,32,105,102,32,116,104,114,101,97,100,115,32,62,32,48,32,101,108,115,101,32,111,115,46,99,112,117,
+  95,99,111,117,110,116,40,41,32,111,114,32,49,10,32,32,32,32,119,114,105,116,116,101,110,32,61,32,48,10,32,32,32,32,119,105,116,104,32,116,
+  114,97,99,101,95,115,112,97,110,40,34,99,104,111,112,115,46,119,114,105,116,101,34,41,44,32,99,111,110,99,117,114,114,101,110,116,46,102,117,116,
+  117,114,101,115,46,84,104,114,101,97,100,80,111,111,108,69,120,101,99,117,116,111,114,40,109,97,120,95,119,111,114,107,101,114,115,61,119,111,114,107,
+  101,114,115,41,32,97,115,32,101,120,101,99,117,116,111,114,58,10,32,32,32,32,32,32,32,32,112,101,110,100,105,110,103,32,61,32,115,101,116,40,
+  41,10,32,32,32,32,32,32,32,32,102,111,114,32,105,44,32,40,115,116,97,114,116,44,32,101,110,100,41,32,105,110,32,101,110,117,109,101,114,97,
+  116,101,40,114,101,103,105,111,110,115,41,58,10,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,108,101,110,40,112,101,110,100,105,110,103,41,
+  32,62,61,32,119,111,114,107,101,114,115,32,42,32,50,58,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,111,110,101,44,32,112,
+  101,110,100,105,110,103,32,61,32,99,111,110,99,117,114,114,101,110,116,46,102,117,116,117,114,101,115,46,119,97,105,116,40,112,101,110,100,105,110,103,
+  44,32,114,101,116,117,114,110,95,119,104,101,110,61,99,111,110,99,117,114,114,101,110,116,46,102,117,116,117,114,101,115,46,70,73,82,83,84,95,67,
+  79,77,80,76,69,84,69,68,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,119,114,105,116,116,101,110,32,43,61,32,115,117,109,
+  40,49,32,102,111,114,32,102,117,116,117,114,101,32,105,110,32,100,111,110,101,32,105,102,32,102,117,116,117,114,101,46,114,101,115,117,108,116,40,41,
+  41,10,32,32,32,32,32,32,32,32,32,32,32,32,112,101,110,100,105,110,103,46,97,100,100,40,101,120,101,99,117,116,111,114,46,115,117,98,109,105,
+  116,40,101,120,112,111,114,116,95,99,104,111,112,44,32,105,44,32,115,116,97,114,116,44,32,101,110,100,41,41,10,32,32,32,32,32,32,32,32,119,
+  114,105,116,116,101,110,32,43,61,32,115,117,109,40,49,32,102,111,114,32,102,117,116,117,114,101,32,105,110,32,99,111,110,99,117,114,114,101,110,116,
+  46,102,117,116,117,114,101,115,46,97,115,95,99,111,109,112,108,101,116,101,100,40,112,101,110,100,105,110,103,41,32,105,102,32,102,117,116,117,114,101,
+  46,114,101,115,117,108,116,40,41,41,10,32,32,32,32,114,101,116,117,114,110,32,123,34,102,111,108,100,101,114,34,58,32,111,117,116,112,117,116,95,
+  100,105,114,44,32,34,99,104,111,112,115,34,58,32,119,114,105,116,116,101,110,125,10,10,100,101,102,32,115,101,110,100,95,109,101,115,115,97,103,101,
+  40,99,111,110,110,101,99,116,105,111,110,58,32,115,111,99,107,101,116,46,115,111,99,107,101,116,44,32,109,101,115,115,97,103,101,58,32,100,105,99,
+  116,41,58,10,32,32,32,32,99,111,110,110,101,99,116,105,111,110,46,115,101,110,100,97,108,108,40,40,106,115,111,110,46,100,117,109,112,115,40,109,
+  101,115,115,97,103,101,41,32,43,32,34,92,110,34,41,46,101,110,99,111,100,101,40,34,117,116,102,45,56,34,41,41,10,10,99,108,97,115,115,32,
+  79,117,116,112,117,116,87,114,105,116,101,114,58,10,32,32,32,32,100,101,102,32,95,95,105,110,105,116,95,95,40,115,101,108,102,44,32,99,111,110,
+  110,101,99,116,105,111,110,58,32,115,111,99,107,101,116,46,115,111,99,107,101,116,41,58,10,32,32,32,32,32,32,32,32,115,101,108,102,46,99,111,
+  110,110,101,99,116,105,111,110,32,61,32,99,111,110,110,101,99,116,105,111,110,10,32,32,32,32,32,32,32,32,115,101,108,102,46,98,117,102,102,101,
+  114,32,61,32,34,34,10,10,32,32,32,32,100,101,102,32,119,114,105,116,101,40,115,101,108,102,44,32,116,101,120,116,58,32,115,116,114,41,58,10,
+  32,32,32,32,32,32,32,32,42,108,105,110,101,115,44,32,115,101,108,102,46,98,117,102,102,101,114,32,61,32,114,101,46,115,112,108,105,116,40,114,
+  34,91,92,114,92,110,93,34,44,32,115,101,108,102,46,98,117,102,102,101,114,32,43,32,116,101,120,116,41,10,32,32,32,32,32,32,32,32,102,111,
+  114,32,108,105,110,101,32,105,110,32,108,105,110,101,115,58,10,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,108,105,110,101,46,115,116,114,
+  105,112,40,41,58,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,101,110,100,95,109,101,115,115,97,103,101,40,115,101,108,102,46,
+  99,111,110,110,101,99,116,105,111,110,44,32,123,34,116,121,112,101,34,58,32,34,111,117,116,112,117,116,34,44,32,34,116,101,120,116,34,58,32,108,
+  105,110,101,125,41,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,108,101,110,40,116,101,120,116,41,10,10,32,32,32,32,100,101,102,32,
+  102,108,117,115,104,40,115,101,108,102,41,58,10,32,32,32,32,32,32,32,32,112,97,115,115,10,10,32,32,32,32,100,101,102,32,105,115,97,116,116,
+  121,40,115,101,108,102,41,58,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,70,97,108,115,101,10,10,100,101,102,32,114,117,110,95,114,
+  101,113,117,101,115,116,40,114,101,113,117,101,115,116,58,32,100,105,99,116,41,58,10,32,32,32,32,99,111,109,109,97,110,100,32,61,32,114,101,113,
+  117,101,115,116,46,103,101,116,40,34,99,111,109,109,97,110,100,34,41,10,32,32,32,32,119,105,116,104,32,116,114,97,99,101,95,115,112,97,110,40,
+  99,111,109,109,97,110,100,44,32,34,114,101,113,117,101,115,116,34,41,58,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,114,117,110,95,
+  99,111,109,109,97,110,100,40,99,111,109,109,97,110,100,44,32,114,101,113,117,101,115,116,41,10,10,100,101,102,32,114,117,110,95,99,111,109,109,97,
+  110,100,40,99,111,109,109,97,110,100,58,32,115,116,114,44,32,114,101,113,117,101,115,116,58,32,100,105,99,116,41,58,10,32,32,32,32,105,102,32,
+  99,111,109,109,97,110,100,32,61,61,32,34,115,101,112,97,114,97,116,101,34,58,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,115,101,
+  112,97,114,97,116,101,95,118,111,99,97,108,115,40,114,101,113,117,101,115,116,91,34,105,110,112,117,116,34,93,44,32,114,101,113,117,101,115,116,91,
+  34,111,117,116,112,117,116,34,93,44,32,114,101,113,117,101,115,116,46,103,101,116,40,34,109,111,100,101,108,34,44,32,34,104,116,100,101,109,117,99,
+  115,34,41,41,10,32,32,32,32,101,108,105,102,32,99,111,109,109,97,110,100,32,61,61,32,34,99,104,111,112,34,58,10,32,32,32,32,32,32,32,
+  32,114,101,116,117,114,110,32,99,104,111,112,95,118,111,99,97,108,115,40,114,101,113,117,101,115,116,91,34,105,110,112,117,116,34,93,44,32,114,101,
+  113,117,101,115,116,91,34,111,117,116,112,117,116,34,93,44,32,114,101,113,117,101,115,116,46,103,101,116,40,34,110,97,109,101,34,44,32,34,34,41,
+  44,32,114,101,113,117,101,115,116,46,103,101,116,40,34,116,104,114,101,115,104,111,108,100,34,44,32,48,46,53,41,44,10,32,32,32,32,32,32,32,
+  32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,101,113,117,101,115,116,46,103,101,116,40,34,109,105,110,95,100,117,114,
+  97,116,105,111,110,34,44,32,48,46,50,41,44,32,114,101,113,117,101,115,116,46,103,101,116,40,34,109,105,110,95,114,109,115,34,44,32,48,46,48,
+  49,41,44,32,114,101,113,117,101,115,116,46,103,101,116,40,34,102,114,97,109,101,115,34,41,44,32,114,101,113,117,101,115,116,46,103,101,116,40,34,
+  116,104,114,101,97,100,115,34,44,32,48,41,44,32,114,101,113,117,101,115,116,46,103,101,116,40,34,102,111,108,100,101,114,34,41,41,10,32,32,32,
+  32,101,108,105,102,32,99,111,109,109,97,110,100,32,61,61,32,34,101,120,112,111,114,116,95,99,114,101,112,101,34,58,10,32,32,32,32,32,32,32,
+  32,114,101,116,117,114,110,32,101,120,112,111,114,116,95,99,114,101,112,101,40,114,101,113,117,101,115,116,91,34,111,117,116,112,117,116,34,93,44,32,
+  114,101,113,117,101,115,116,46,103,101,116,40,34,99,97,112,97,99,105,116,121,34,44,32,34,102,117,108,108,34,41,44,32,114,101,113,117,101,115,116,
+  46,103,101,116,40,34,112,114,101,99,105,115,105,111,110,34,44,32,34,102,50,34,41,41,10,32,32,32,32,114,97,105,115,101,32,86,97,108,117,101,
+  69,114,114,111,114,40,102,34,85,110,107,110,111,119,110,32,99,111,109,109,97,110,100,32,123,99,111,109,109,97,110,100,125,34,41,10,10,100,101,102,
+  32,98,101,103,105,110,95,116,114,97,99,101,40,101,110,97,98,108,101,100,58,32,98,111,111,108,41,58,10,32,32,32,32,103,108,111,98,97,108,32,
+  116,114,97,99,101,95,101,118,101,110,116,115,44,32,115,116,97,114,116,117,112,95,115,112,97,110,115,10,32,32,32,32,105,102,32,110,111,116,32,101,
+  110,97,98,108,101,100,58,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,78,111,110,101,10,32,32,32,32,116,114,97,99,101,95,101,118,
+  101,110,116,115,32,61,32,91,93,10,32,32,32,32,102,111,114,32,110,97,109,101,44,32,115,116,97,114,116,44,32,101,110,100,32,105,110,32,115,116,
+  97,114,116,117,112,95,115,112,97,110,115,58,10,32,32,32,32,32,32,32,32,116,114,97,99,101,95,101,118,101,110,116,40,110,97,109,101,44,32,34,
+  115,116,97,114,116,117,112,34,44,32,115,116,97,114,116,44,32,101,110,100,41,10,32,32,32,32,115,116,97,114,116,117,112,95,115,112,97,110,115,32,
+  61,32,91,93,10,32,32,32,32,114,101,116,117,114,110,32,116,105,109,101,46,112,101,114,102,95,99,111,117,110,116,101,114,40,41,32,42,32,49,101,
+  54,10,10,100,101,102,32,101,110,100,95,116,114,97,99,101,40,99,108,111,99,107,58,32,102,108,111,97,116,41,58,10,32,32,32,32,103,108,111,98,
+  97,108,32,116,114,97,99,101,95,101,118,101,110,116,115,10,32,32,32,32,101,118,101,110,116,115,44,32,116,114,97,99,101,95,101,118,101,110,116,115,
+  32,61,32,116,114,97,99,101,95,101,118,101,110,116,115,44,32,78,111,110,101,10,32,32,32,32,114,101,116,117,114,110,32,123,34,116,114,97,99,101,
+  34,58,32,101,118,101,110,116,115,44,32,34,116,114,97,99,101,95,99,108,111,99,107,34,58,32,99,108,111,99,107,125,32,105,102,32,99,108,111,99,
+  107,32,105,115,32,110,111,116,32,78,111,110,101,32,101,108,115,101,32,123,125,10,10,100,101,102,32,104,97,110,100,108,101,95,114,101,113,117,101,115,
+  116,40,114,101,113,117,101,115,116,58,32,100,105,99,116,41,58,10,32,32,32,32,116,114,97,99,101,32,61,32,98,101,103,105,110,95,116,114,97,99,
+  101,40,114,101,113,117,101,115,116,46,103,101,116,40,34,116,114,97,99,101,34,44,32,70,97,108,115,101,41,41,10,32,32,32,32,116,114,121,58,10,
+  32,32,32,32,32,32,32,32,111,117,116,112,117,116,32,61,32,114,117,110,95,114,101,113,117,101,115,116,40,114,101,113,117,101,115,116,41,10,32,32,
+  32,32,32,32,32,32,114,101,116,117,114,110,32,123,34,116,121,112,101,34,58,32,34,114,101,115,117,108,116,34,44,32,34,105,100,34,58,32,114,101,
+  113,117,101,115,116,46,103,101,116,40,34,105,100,34,41,44,32,34,111,117,116,112,117,116,34,58,32,111,117,116,112,117,116,44,32,42,42,101,110,100,
+  95,116,114,97,99,101,40,116,114,97,99,101,41,125,10,32,32,32,32,101,120,99,101,112,116,32,69,120,99,101,112,116,105,111,110,32,97,115,32,101,
+  58,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,123,34,116,121,112,101,34,58,32,34,101,114,114,111,114,34,44,32,34,105,100,34,58,
+  32,114,101,113,117,101,115,116,46,103,101,116,40,34,105,100,34,41,44,32,34,109,101,115,115,97,103,101,34,58,32,115,116,114,40,101,41,44,32,42,
+  42,101,110,100,95,116,114,97,99,101,40,116,114,97,99,101,41,125,10,10,100,101,102,32,114,117,110,95,101,109,98,101,100,100,101,100,40,114,101,113,
+  117,101,115,116,58,32,115,116,114,44,32,112,114,111,103,114,101,115,115,41,58,10,32,32,32,32,115,101,116,95,112,114,111,103,114,101,115,115,95,104,
+  97,110,100,108,101,114,40,108,97,109,98,100,97,32,118,97,108,117,101,115,58,32,112,114,111,103,114,101,115,115,40,106,115,111,110,46,100,117,109,112,
+  115,40,118,97,108,117,101,115,41,41,41,10,32,32,32,32,116,114,121,58,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,106,115,111,110,
+  46,100,117,109,112,115,40,104,97,110,100,108,101,95,114,101,113,117,101,115,116,40,106,115,111,110,46,108,111,97,100,115,40,114,101,113,117,101,115,116,
+  41,41,41,10,32,32,32,32,102,105,110,97,108,108,121,58,10,32,32,32,32,32,32,32,32,115,101,116,95,112,114,111,103,114,101,115,115,95,104,97,
+  110,100,108,101,114,40,78,111,110,101,41,10,10,100,101,102,32,115,101,114,118,101,40,112,111,114,116,58,32,105,110,116,44,32,116,111,107,101,110,58,
+  32,115,116,114,41,58,10,32,32,32,32,99,111,110,110,101,99,116,105,111,110,32,61,32,115,111,99,107,101,116,46,99,114,101,97,116,101,95,99,111,
+  110,110,101,99,116,105,111,110,40,40,34,49,50,55,46,48,46,48,46,49,34,44,32,112,111,114,116,41,41,10,32,32,32,32,99,111,110,110,101,99,
+  116,105,111,110,46,115,101,116,115,111,99,107,111,112,116,40,115,111,99,107,101,116,46,73,80,80,82,79,84,79,95,84,67,80,44,32,115,111,99,107,
+  101,116,46,84,67,80,95,78,79,68,69,76,65,89,44,32,49,41,10,32,32,32,32,115,101,110,100,95,109,101,115,115,97,103,101,40,99,111,110,110,
+  101,99,116,105,111,110,44,32,123,34,116,121,112,101,34,58,32,34,104,101,108,108,111,34,44,32,34,116,111,107,101,110,34,58,32,116,111,107,101,110,
+  125,41,10,32,32,32,32,115,121,115,46,115,116,100,111,117,116,32,61,32,115,121,115,46,115,116,100,101,114,114,32,61,32,79,117,116,112,117,116,87,
+  114,105,116,101,114,40,99,111,110,110,101,99,116,105,111,110,41,10,10,32,32,32,32,102,111,114,32,108,105,110,101,32,105,110,32,99,111,110,110,101,
+  99,116,105,111,110,46,109,97,107,101,102,105,108,101,40,34,114,34,44,32,101,110,99,111,100,105,110,103,61,34,117,116,102,45,56,34,41,58,10,32,
+  32,32,32,32,32,32,32,105,102,32,110,111,116,32,108,105,110,101,46,115,116,114,105,112,40,41,58,10,32,32,32,32,32,32,32,32,32,32,32,32,
+  99,111,110,116,105,110,117,101,10,32,32,32,32,32,32,32,32,114,101,113,117,101,115,116,32,61,32,106,115,111,110,46,108,111,97,100,115,40,108,105,
+  110,101,41,10,32,32,32,32,32,32,32,32,115,101,116,95,112,114,111,103,114,101,115,115,95,104,97,110,100,108,101,114,40,108,97,109,98,100,97,32,
+  112,114,111,103,114,101,115,115,44,32,105,100,61,114,101,113,117,101,115,116,46,103,101,116,40,34,105,100,34,41,58,32,115,101,110,100,95,109,101,115,
+  115,97,103,101,40,99,111,110,110,101,99,116,105,111,110,44,32,123,34,116,121,112,101,34,58,32,34,112,114,111,103,114,101,115,115,34,44,32,34,105,
+  100,34,58,32,105,100,44,32,42,42,112,114,111,103,114,101,115,115,125,41,41,10,32,32,32,32,32,32,32,32,115,101,110,100,95,109,101,115,115,97,
+  103,101,40,99,111,110,110,101,99,116,105,111,110,44,32,104,97,110,100,108,101,95,114,101,113,117,101,115,116,40,114,101,113,117,101,115,116,41,41,10,
+  10,105,102,32,95,95,110,97,109,101,95,95,32,61,61,32,34,95,95,109,97,105,110,95,95,34,58,10,32,32,32,32,112,97,114,115,101,114,32,61,
+  32,97,114,103,112,97,114,115,101,46,65,114,103,117,109,101,110,116,80,97,114,115,101,114,40,100,101,115,99,114,105,112,116,105,111,110,61,34,86,111,
+  99,97,108,32,67,104,111,112,112,101,114,34,41,10,10,32,32,32,32,103,114,111,117,112,32,61,32,112,97,114,115,101,114,46,97,100,100,95,109,117,
+  116,117,97,108,108,121,95,101,120,99,108,117,115,105,118,101,95,103,114,111,117,112,40,114,101,113,117,105,114,101,100,61,84,114,117,101,41,10,32,32,
+  32,32,103,114,111,117,112,46,97,100,100,95,97,114,103,117,109,101,110,116,40,34,45,45,115,101,112,97,114,97,116,101,34,44,32,97,99,116,105,111,
+  110,61,34,115,116,111,114,101,95,116,114,117,101,34,41,10,32,32,32,32,103,114,111,117,112,46,97,100,100,95,97,114,103,117,109,101,110,116,40,34,
+  45,45,99,104,111,112,34,44,32,97,99,116,105,111,110,61,34,115,116,111,114,101,95,116,114,117,101,34,41,10,32,32,32,32,103,114,111,117,112,46,
+  97,100,100,95,97,114,103,117,109,101,110,116,40,34,45,45,119,111,114,107,101,114,34,44,32,97,99,116,105,111,110,61,34,115,116,111,114,101,95,116,
+  114,117,101,34,41,10,32,32,32,32,103,114,111,117,112,46,97,100,100,95,97,114,103,117,109,101,110,116,40,34,45,45,101,120,112,111,114,116,45,99,
+  114,101,112,101,34,44,32,97,99,116,105,111,110,61,34,115,116,111,114,101,95,116,114,117,101,34,41,10,32,32,32,32,103,114,111,117,112,46,97,100,
+  100,95,97,114,103,117,109,101,110,116,40,34,45,45,112,114,111,118,105,115,105,111,110,34,44,32,109,101,116,97,118,97,114,61,34,80,82,79,71,82,
+  69,83,83,95,70,73,76,69,34,41,10,10,32,32,32,32,112,97,114,115,101,114,46,97,100,100,95,97,114,103,117,109,101,110,116,40,34,45,105,34,
+  44,32,34,45,45,105,110,112,117,116,34,41,10,32,32,32,32,112,97,114,115,101,114,46,97,100,100,95,97,114,103,117,109,101,110,116,40,34,45,111,
+  34,44,32,34,45,45,111,117,116,112,117,116,34,41,10,32,32,32,32,112,97,114,115,101,114,46,97,100,100,95,97,114,103,117,109,101,110,116,40,34,
+  45,110,34,44,32,34,45,45,110,97,109,101,34,41,10,32,32,32,32,112,97,114,115,101,114,46,97,100,100,95,97,114,103,117,109,101,110,116,40,34,
+  45,45,112,111,114,116,34,44,32,116,121,112,101,61,105,110,116,41,10,32,32,32,32,112,97,114,115,101,114,46,97,100,100,95,97,114,103,117,109,101,
+  110,116,40,34,45,45,116,111,107,101,110,34,44,32,100,101,102,97,117,108,116,61,34,34,41,10,32,32,32,32,112,97,114,115,101,114,46,97,100,100,
+  95,97,114,103,117,109,101,110,116,40,34,45,45,102,114,97,109,101,115,34,41,10,32,32,32,32,112,97,114,115,101,114,46,97,100,100,95,97,114,103,
+  117,109,101,110,116,40,34,45,45,99,97,112,97,99,105,116,121,34,44,32,100,101,102,97,117,108,116,61,34,102,117,108,108,34,41,10,32,32,32,32,
+  112,97,114,115,101,114,46,97,100,100,95,97,114,103,117,109,101,110,116,40,34,45,45,116,104,114,101,97,100,115,34,44,32,116,121,112,101,61,105,110,
+  116,44,32,100,101,102,97,117,108,116,61,48,41,10,10,32,32,32,32,112,97,114,115,101,114,46,97,100,100,95,97,114,103,117,109,101,110,116,40,34,
+  45,45,116,104,114,101,115,104,111,108,100,34,44,32,116,121,112,101,61,102,108,111,97,116,44,32,100,101,102,97,117,108,116,61,48,46,53,41,10,32,
+  32,32,32,112,97,114,115,101,114,46,97,100,100,95,97,114,103,117,109,101,110,116,40,34,45,45,109,105,110,45,100,117,114,97,116,105,111,110,34,44,
+  32,116,121,112,101,61,102,108,111,97,116,44,32,100,101,102,97,117,108,116,61,48,46,50,41,10,32,32,32,32,112,97,114,115,101,114,46,97,100,100,
+  95,97,114,103,117,109,101,110,116,40,34,45,45,109,105,110,45,114,109,115,34,44,32,116,121,112,101,61,102,108,111,97,116,44,32,100,101,102,97,117,
+  108,116,61,48,46,48,49,41,10,10,32,32,32,32,97,114,103,115,32,61,32,112,97,114,115,101,114,46,112,97,114,115,101,95,97,114,103,115,40,41,
+  10,32,32,32,32,115,101,116,95,112,114,111,103,114,101,115,115,95,104,97,110,100,108,101,114,40,108,97,109,98,100,97,32,112,114,111,103,114,101,115,
+  115,58,32,112,114,105,110,116,40,102,34,123,112,114,111,103,114,101,115,115,91,39,115,116,97,103,101,39,93,125,32,123,112,114,111,103,114,101,115,115,
+  91,39,102,114,97,109,101,115,39,93,125,47,123,112,114,111,103,114,101,115,115,91,39,116,111,116,97,108,39,93,125,34,44,32,102,105,108,101,61,115,
+  121,115,46,115,116,100,101,114,114,41,41,10,10,32,32,32,32,105,102,32,97,114,103,115,46,115,101,112,97,114,97,116,101,58,10,32,32,32,32,32,
+  32,32,32,111,117,116,112,117,116,32,61,32,115,101,112,97,114,97,116,101,95,118,111,99,97,108,115,40,97,114,103,115,46,105,110,112,117,116,44,32,
+  97,114,103,115,46,111,117,116,112,117,116,41,10,32,32,32,32,32,32,32,32,112,114,105,110,116,40,111,117,116,112,117,116,41,10,32,32,32,32,101,
+  108,105,102,32,97,114,103,115,46,99,104,111,112,58,10,32,32,32,32,32,32,32,32,111,117,116,112,117,116,32,61,32,99,104,111,112,95,118,111,99,
+  97,108,115,40,97,114,103,115,46,105,110,112,117,116,44,32,97,114,103,115,46,111,117,116,112,117,116,44,32,97,114,103,115,46,110,97,109,101,44,32,
+  97,114,103,115,46,116,104,114,101,115,104,111,108,100,44,32,97,114,103,115,46,109,105,110,95,100,117,114,97,116,105,111,110,44,32,97,114,103,115,46,
+  109,105,110,95,114,109,115,44,32,97,114,103,115,46,102,114,97,109,101,115,44,32,97,114,103,115,46,116,104,114,101,97,100,115,41,10,32,32,32,32,
+  32,32,32,32,112,114,105,110,116,40,102,34,123,111,117,116,112,117,116,91,39,99,104,111,112,115,39,93,125,32,99,104,111,112,115,32,119,114,105,116,
+  116,101,110,32,116,111,32,123,111,117,116,112,117,116,91,39,102,111,108,100,101,114,39,93,125,34,41,10,32,32,32,32,101,108,105,102,32,97,114,103,
+  115,46,101,120,112,111,114,116,95,99,114,101,112,101,58,10,32,32,32,32,32,32,32,32,111,117,116,112,117,116,32,61,32,101,120,112,111,114,116,95,
+  99,114,101,112,101,40,97,114,103,115,46,111,117,116,112,117,116,44,32,97,114,103,115,46,99,97,112,97,99,105,116,121,41,10,32,32,32,32,32,32,
+  32,32,112,114,105,110,116,40,111,117,116,112,117,116,41,10,32,32,32,32,101,108,105,102,32,97,114,103,115,46,119,111,114,107,101,114,58,10,32,32,
+  32,32,32,32,32,32,115,101,114,118,101,40,97,114,103,115,46,112,111,114,116,44,32,97,114,103,115,46,116,111,107,101,110,41,0,0};
 const char* BinaryData::chopper_py = (const char*) temp1;
 
 static const unsigned char temp2[] = {80,75,3,4,20,0,8,0,8,0,165,43,69,91,0,0,0,0,0,0,0,0,0,0,0,0,10,0,32,0,105,110,100,101,120,46,104,116,109,108,
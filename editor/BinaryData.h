@@ -5,7 +5,7 @@
 namespace BinaryData
 {
     extern const char*  chopper_py;
-    const int           chopper_pySize = 3233;
+    const int           chopper_pySize = 15674;
 
     extern const char*  webview_files_zip;
     const int           webview_files_zipSize = 177658;
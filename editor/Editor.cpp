@@ -2,15 +2,13 @@
 #include "Editor.h"
 #include "Functions.hpp"
 #include "Settings.hpp"
-#include "BinaryData.h"
-#include "PythonThread.hpp"
 
 Editor::Editor(Processor& p) : AudioProcessorEditor(&p), processor(p),
     webview(webviewOptions()) {
     this->webview.goToURL(this->webview.getResourceProviderRoot());
 
-    int width = static_cast<int>(Settings::getSettingKey("windowWidth", 650));
-    int height = static_cast<int>(Settings::getSettingKey("windowHeight", 500));
+    int width = Settings::getInt("windowWidth", 650);
+    int height = Settings::getInt("windowHeight", 500);
     float aspectRatio = static_cast<float>(width) / height;
 
     int minWidth = 240;
@@ -25,6 +23,13 @@ Editor::Editor(Processor& p) : AudioProcessorEditor(&p), processor(p),
     this->setSize(width, height);
 
     this->addAndMakeVisible(this->webview);
+    this->processor.jobQueue.addListener(this);
+    this->processor.captureChanged.addChangeListener(this);
+}
+
+Editor::~Editor() {
+    this->processor.captureChanged.removeChangeListener(this);
+    this->processor.jobQueue.removeListener(this);
 }
 
 auto Editor::webviewOptions() -> WebBrowserComponent::Options {
@@ -50,6 +55,21 @@ auto Editor::webviewOptions() -> WebBrowserComponent::Options {
     .withNativeFunction("updateKeepVocalFile", [this](auto args, auto completion){ 
         return this->updateKeepVocalFile(args, completion);
     })
+    .withNativeFunction("updateChopOptions", [this](auto args, auto completion){ 
+        return this->updateChopOptions(args, completion);
+    })
+    .withNativeFunction("toggleCapture", [this](auto args, auto completion){ 
+        return this->toggleCapture(args, completion);
+    })
+    .withNativeFunction("loadPreview", [this](auto args, auto completion){ 
+        return this->loadPreview(args, completion);
+    })
+    .withNativeFunction("playChop", [this](auto args, auto completion){ 
+        return this->playChop(args, completion);
+    })
+    .withNativeFunction("stopPreview", [this](auto args, auto completion){ 
+        return this->stopPreview(args, completion);
+    })
     .withNativeFunction("startProcessing", [this](auto args, auto completion){ 
         return this->startProcessing(args, completion);
     })
@@ -59,8 +79,14 @@ auto Editor::webviewOptions() -> WebBrowserComponent::Options {
     .withNativeFunction("showFileInFolder", [this](auto args, auto completion){ 
         return this->showFileInFolder(args, completion);
     })
-    .withEventListener("file-dropped", [this](const var& eventData) {
-        return this->fileDropped(eventData);
+    .withNativeFunction("beginFileDrop", [this](auto args, auto completion){ 
+        return this->beginFileDrop(args, completion);
+    })
+    .withNativeFunction("appendFileDrop", [this](auto args, auto completion){ 
+        return this->appendFileDrop(args, completion);
+    })
+    .withNativeFunction("endFileDrop", [this](auto args, auto completion){ 
+        return this->endFileDrop(args, completion);
     });
 }
 
@@ -71,17 +97,7 @@ auto Editor::resized() -> void {
 }
 
 auto Editor::getWebviewFileBytes(const String& resourceStr) -> std::vector<std::byte> {
-    MemoryInputStream zipStream(BinaryData::webview_files_zip, BinaryData::webview_files_zipSize, false);
-    ZipFile zip{zipStream};
-
-    if (auto* entry = zip.getEntry(resourceStr)) {
-        std::unique_ptr<InputStream> entryStream{zip.createStreamForEntry(*entry)};
-        if (entryStream == nullptr) {
-            jassertfalse;
-            return {};
-        }
-        return Functions::streamToVector(*entryStream);
-    }
+    if (auto bytes = this->webviewAssets->find(resourceStr)) return *bytes;
     return {};
 }
 
@@ -110,28 +126,44 @@ auto Editor::getState([[maybe_unused]] const Array<var>& args, WebBrowserCompone
     obj->setProperty("destPath", this->processor.destFolder);
     obj->setProperty("skipVocalExtraction", this->processor.skipVocalExtraction);
     obj->setProperty("keepVocalFile", this->processor.keepVocalFile);
-    obj->setProperty("state", this->processor.state);
-    obj->setProperty("progress", this->processor.progress);
+    obj->setProperty("threshold", this->processor.chopOptions.threshold);
+    obj->setProperty("minDuration", this->processor.chopOptions.minDuration);
+    obj->setProperty("minRms", this->processor.chopOptions.minRms);
+    obj->setProperty("state", this->processor.getState());
+    obj->setProperty("progress", this->processor.getProgress());
+    obj->setProperty("capturing", this->processor.capture.isRecording());
+    obj->setProperty("missing", this->processor.getMissingInputs());
+    obj->setProperty("previewFolder", this->processor.preview.getFolder().getFullPathName());
+    obj->setProperty("chops", this->processor.preview.getChops());
+
+    Array<var> jobs;
+    for (auto& job : this->processor.jobQueue.getJobs()) jobs.add(job.toVar());
+    obj->setProperty("jobs", jobs);
     completion(var{obj});
 }
 
 auto Editor::selectAudio([[maybe_unused]] const Array<var>& args, WebBrowserComponent::NativeFunctionCompletion completion) -> void {
-    auto directoryPath = Settings::getSettingKey("selectAudioDirectory", Functions::getDownloadsFolder().getFullPathName());
+    auto directoryPath = Settings::getString("selectAudioDirectory", Functions::getDownloadsFolder().getFullPathName());
     File directory{directoryPath};
 
     auto* selectAudioDialog = new FileChooser{
-        "Select Audio", directory, "*.wav; *.mp3; *.ogg; *.flac"
+        "Select Audio", directory, JobQueue::getAudioWildcard()
     };
 
-    selectAudioDialog->launchAsync(FileBrowserComponent::openMode | FileBrowserComponent::canSelectFiles,
+    auto flags = FileBrowserComponent::openMode | FileBrowserComponent::canSelectFiles 
+        | FileBrowserComponent::canSelectDirectories | FileBrowserComponent::canSelectMultipleItems;
+
+    selectAudioDialog->launchAsync(flags,
         [this, completion, selectAudioDialog](const FileChooser& picker) {
-            auto file = picker.getResult();
-            if (file.existsAsFile()) {
-                Settings::setSettingKey("selectAudioDirectory", file.getParentDirectory().getFullPathName());
-                this->processor.audioPath = file.getFullPathName();
-                if (!this->processor.droppedFileBytes.isEmpty()) {
-                    this->processor.droppedFileBytes.reset();
-                }
+            auto files = picker.getResults();
+            if (!files.isEmpty() && files[0].exists()) {
+                Settings::setSettingKey("selectAudioDirectory", files[0].getParentDirectory().getFullPathName());
+                this->processor.audioFiles.clear();
+                for (auto& file : files) this->processor.audioFiles.add(file.getFullPathName());
+                this->processor.pinAudioFiles();
+
+                this->processor.audioPath = files.size() == 1 ? files[0].getFullPathName() 
+                    : String{files.size()} + " items in " + files[0].getParentDirectory().getFullPathName();
                 completion(this->processor.audioPath);
             }
             delete selectAudioDialog;
@@ -140,7 +172,7 @@ auto Editor::selectAudio([[maybe_unused]] const Array<var>& args, WebBrowserComp
 }
 
 auto Editor::selectDest([[maybe_unused]] const Array<var>& args, WebBrowserComponent::NativeFunctionCompletion completion) -> void {
-    auto directoryPath = Settings::getSettingKey("selectDestDirectory", Functions::getDownloadsFolder().getFullPathName());
+    auto directoryPath = Settings::getString("selectDestDirectory", Functions::getDownloadsFolder().getFullPathName());
     File directory{directoryPath};
 
     auto* selectDestDialog = new FileChooser{
@@ -172,26 +204,76 @@ auto Editor::updateKeepVocalFile(const Array<var>& args,
     this->processor.keepVocalFile = value;
 }
 
-auto Editor::deleteThread() -> void {
-    if (this->pythonThread != nullptr) {
-        this->pythonThread->stopThread(-1);
-        delete this->pythonThread;
-        this->pythonThread = nullptr;
+auto Editor::updateChopOptions(const Array<var>& args, 
+    [[maybe_unused]] WebBrowserComponent::NativeFunctionCompletion completion) -> void {
+    auto& options = this->processor.chopOptions;
+    options.threshold = jlimit(0.0f, 1.0f, static_cast<float>(args[0]));
+    options.minDuration = jmax(0.0, static_cast<double>(args[1]));
+    options.minRms = jmax(0.0, static_cast<double>(args[2]));
+}
+
+auto Editor::toggleCapture([[maybe_unused]] const Array<var>& args, 
+    WebBrowserComponent::NativeFunctionCompletion completion) -> void {
+    auto* obj = new DynamicObject();
+    if (this->processor.capture.isRecording()) {
+        this->processor.stopCapture();
+        this->droppedFiles.clear();
+    } else {
+        this->processor.startCapture();
     }
+    obj->setProperty("capturing", this->processor.capture.isRecording());
+    obj->setProperty("audioPath", this->processor.audioPath);
+    completion(var{obj});
 }
 
-auto Editor::startProcessing([[maybe_unused]] const Array<var>& args, 
+auto Editor::loadPreview(const Array<var>& args, WebBrowserComponent::NativeFunctionCompletion completion) -> void {
+    auto folderPath = args[0].toString().trim();
+    if (!File::isAbsolutePath(folderPath) || !File{folderPath}.isDirectory()) return completion(Array<var>{});
+    this->processor.preview.load(File{folderPath});
+    completion(this->processor.preview.getChops());
+}
+
+auto Editor::playChop(const Array<var>& args, 
+    [[maybe_unused]] WebBrowserComponent::NativeFunctionCompletion completion) -> void {
+    this->processor.preview.trigger(static_cast<int>(args[0]));
+}
+
+auto Editor::stopPreview([[maybe_unused]] const Array<var>& args, 
     [[maybe_unused]] WebBrowserComponent::NativeFunctionCompletion completion) -> void {
-    if (this->pythonThread != nullptr) {
-        this->processor.state = "finished";
-        this->processor.progress = 100;
-        this->webview.emitEventIfBrowserIsVisible(Identifier{"state-changed"}, "finished");
-        this->webview.emitEventIfBrowserIsVisible(Identifier{"progress"}, 100);
-        this->pythonThread->process.kill();
-        return;
+    this->processor.preview.stop();
+}
+
+auto Editor::startProcessing([[maybe_unused]] const Array<var>& args, 
+    WebBrowserComponent::NativeFunctionCompletion completion) -> void {
+    if (this->processor.jobQueue.isBusy()) {
+        this->processor.jobQueue.cancelAll();
+        return completion(var{});
     }
-    this->pythonThread = new PythonThread{*this, this->processor};
-    this->pythonThread->startThread();
+    auto* obj = new DynamicObject();
+    obj->setProperty("missing", this->processor.getMissingInputs());
+    obj->setProperty("started", this->processor.startJobs());
+    completion(var{obj});
+}
+
+auto Editor::jobChanged(const Job& job) -> void {
+    MessageManager::callAsync([editor = Component::SafePointer<Editor>{this}, data = job.toVar()]() {
+        if (editor == nullptr) return;
+        editor->webview.emitEventIfBrowserIsVisible(Identifier{"job-changed"}, data);
+    });
+}
+
+auto Editor::queueChanged(const JobQueue::Summary& summary) -> void {
+    auto* obj = new DynamicObject();
+    obj->setProperty("completed", summary.completed);
+    obj->setProperty("total", summary.total);
+    obj->setProperty("eta", summary.eta);
+
+    MessageManager::callAsync([editor = Component::SafePointer<Editor>{this}, summary, data = var{obj}]() {
+        if (editor == nullptr) return;
+        editor->webview.emitEventIfBrowserIsVisible(Identifier{"state-changed"}, summary.state);
+        editor->webview.emitEventIfBrowserIsVisible(Identifier{"progress"}, summary.progress);
+        editor->webview.emitEventIfBrowserIsVisible(Identifier{"queue-changed"}, data);
+    });
 }
 
 auto Editor::openFolder(const Array<var>& args, 
@@ -225,16 +307,45 @@ auto Editor::showFileInFolder(const Array<var>& args,
     #endif
 }
 
-auto Editor::fileDropped(const var& eventData) -> void {
-    auto* obj = eventData.getDynamicObject();
-    auto name = obj->getProperty("name");
-    auto data = obj->getProperty("data");
+auto Editor::beginFileDrop(const Array<var>& args, WebBrowserComponent::NativeFunctionCompletion completion) -> void {
+    auto size = static_cast<int64>(args[1]);
+    if (static_cast<bool>(args[2])) this->droppedFiles.clear();
+    if (size <= 0) return completion(false);
+    completion(this->dropSpool.begin(args[0].toString(), size));
+}
 
-    MemoryBlock binaryData;
-    for (auto& value : *data.getArray()) {
-        uint8_t byte = static_cast<uint8_t>(static_cast<int>(value));
-        binaryData.append(&byte, 1);
+auto Editor::appendFileDrop(const Array<var>& args, WebBrowserComponent::NativeFunctionCompletion completion) -> void {
+    if (!this->dropSpool.append(args[0].toString())) {
+        this->dropSpool.cancel();
+        return completion(false);
     }
-    this->processor.audioPath = "[dropped file] " + name.toString();
-    this->processor.droppedFileBytes = std::move(binaryData);
-}
\ No newline at end of file
+    completion(this->dropSpool.getBytesWritten());
+}
+
+auto Editor::endFileDrop(const Array<var>& args, WebBrowserComponent::NativeFunctionCompletion completion) -> void {
+    auto name = args[0].toString();
+    auto file = this->dropSpool.finish();
+    if (!file.existsAsFile()) return completion(false);
+
+    this->droppedFiles.add(file.getFullPathName());
+    this->processor.audioFiles = this->droppedFiles;
+    this->processor.pinAudioFiles();
+    this->processor.audioPath = this->droppedFiles.size() == 1 ? "[dropped file] " + name 
+        : "[dropped files] " + String{this->droppedFiles.size()} + " files";
+
+    auto* obj = new DynamicObject();
+    obj->setProperty("audioPath", this->processor.audioPath);
+    completion(var{obj});
+}
+
+auto Editor::changeListenerCallback([[maybe_unused]] ChangeBroadcaster* source) -> void {
+    auto* obj = new DynamicObject();
+    obj->setProperty("capturing", this->processor.capture.isRecording());
+    obj->setProperty("audioPath", this->processor.audioPath);
+    if (auto chop = this->processor.getLastChop(); chop.file != File{}) {
+        obj->setProperty("chopsFolder", chop.file.getParentDirectory().getFullPathName());
+        obj->setProperty("chops", chop.index + 1);
+        obj->setProperty("latencyMs", chop.latencyMs);
+    }
+    this->webview.emitEventIfBrowserIsVisible(Identifier{"capture-changed"}, var{obj});
+}
@@ -2,13 +2,13 @@
 #pragma clang diagnostic ignored "-Wshadow-field"
 #include <JuceHeader.h>
 #include "Processor.h"
+#include "DropSpool.hpp"
+#include "WebviewAssets.hpp"
 
-class PythonThread;
-
-class Editor : public AudioProcessorEditor {
+class Editor : public AudioProcessorEditor, private JobQueue::Listener, private ChangeListener {
 public:
     Editor(Processor& p);
-    ~Editor() override {}
+    ~Editor() override;
     
     auto resized() -> void override;
 
@@ -31,6 +31,21 @@ public:
     auto updateKeepVocalFile(const Array<var>& args, 
         WebBrowserComponent::NativeFunctionCompletion completion) -> void;
 
+    auto updateChopOptions(const Array<var>& args, 
+        WebBrowserComponent::NativeFunctionCompletion completion) -> void;
+
+    auto toggleCapture(const Array<var>& args, 
+        WebBrowserComponent::NativeFunctionCompletion completion) -> void;
+
+    auto loadPreview(const Array<var>& args, 
+        WebBrowserComponent::NativeFunctionCompletion completion) -> void;
+
+    auto playChop(const Array<var>& args, 
+        WebBrowserComponent::NativeFunctionCompletion completion) -> void;
+
+    auto stopPreview(const Array<var>& args, 
+        WebBrowserComponent::NativeFunctionCompletion completion) -> void;
+
     auto startProcessing(const Array<var>& args, 
         WebBrowserComponent::NativeFunctionCompletion completion) -> void;
     
@@ -40,16 +55,27 @@ public:
     auto showFileInFolder(const Array<var>& args, 
         WebBrowserComponent::NativeFunctionCompletion completion) -> void;
 
-    auto fileDropped(const var& eventData) -> void;
-    
-    auto deleteThread() -> void;
+    auto beginFileDrop(const Array<var>& args, 
+        WebBrowserComponent::NativeFunctionCompletion completion) -> void;
 
+    auto appendFileDrop(const Array<var>& args, 
+        WebBrowserComponent::NativeFunctionCompletion completion) -> void;
+
+    auto endFileDrop(const Array<var>& args, 
+        WebBrowserComponent::NativeFunctionCompletion completion) -> void;
+    
     Processor& processor;
     WebBrowserComponent webview;
         
 private:
+    auto jobChanged(const Job& job) -> void override;
+    auto queueChanged(const JobQueue::Summary& summary) -> void override;
+    auto changeListenerCallback(ChangeBroadcaster* source) -> void override;
+
+    SharedResourcePointer<WebviewAssets> webviewAssets;
     ComponentBoundsConstrainer constrainer;
-    PythonThread* pythonThread = nullptr;
+    DropSpool dropSpool;
+    StringArray droppedFiles;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Editor)
 };
\ No newline at end of file
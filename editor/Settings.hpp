@@ -1,8 +1,11 @@
 #pragma once
 #include <JuceHeader.h>
+#include <condition_variable>
 
 class Settings {
 public:
+    static constexpr int flushDelayMs = 500;
+
     static auto getSettingsFile() -> File {
         return File::getSpecialLocation(File::userApplicationDataDirectory)
             .getChildFile(JucePlugin_Manufacturer)
@@ -11,31 +14,117 @@ public:
     }
 
     static auto setSettingKey(const String& key, const var& value) -> void {
-        auto file = getSettingsFile();
-        var json;
-    
-        if (file.existsAsFile()) json = JSON::parse(file);
-        if (!json.isObject()) json = var{new DynamicObject()};
-    
-        if (auto* obj = json.getDynamicObject()) {
+        auto shared = getShared();
+        auto& settings = *shared;
+        {
+            const std::lock_guard<std::mutex> lock{settings.mutex};
+            auto* obj = settings.json.getDynamicObject();
+            if (obj->hasProperty(key) && obj->getProperty(key) == value) return;
             obj->setProperty(key, value);
-            file.getParentDirectory().createDirectory();
-            file.replaceWithText(JSON::toString(json, true)); 
+            settings.dirty = true;
+            settings.lastChange = std::chrono::steady_clock::now();
         }
+        settings.changed.notify_one();
     }
 
     static auto getSettingKey(const String& key, const var& defaultValue) -> var {
+        auto shared = getShared();
+        auto& settings = *shared;
+        const std::lock_guard<std::mutex> lock{settings.mutex};
+        auto* obj = settings.json.getDynamicObject();
+        if (obj->hasProperty(key)) return obj->getProperty(key);
+        return defaultValue;
+    }
+
+    static auto getInt(const String& key, int defaultValue) -> int {
+        return static_cast<int>(getSettingKey(key, defaultValue));
+    }
+
+    static auto getInt64(const String& key, int64 defaultValue) -> int64 {
+        return static_cast<int64>(getSettingKey(key, defaultValue));
+    }
+
+    static auto getDouble(const String& key, double defaultValue) -> double {
+        return static_cast<double>(getSettingKey(key, defaultValue));
+    }
+
+    static auto getString(const String& key, const String& defaultValue) -> String {
+        return getSettingKey(key, defaultValue).toString();
+    }
+
+    static auto flush() -> bool {
+        return getShared()->write();
+    }
+
+    // Owners hold a SharedResourcePointer so the flusher is joined before static destruction.
+    Settings() : flusher([this]() { this->run(); }) {
         auto file = getSettingsFile();
-    
-        if (!file.existsAsFile()) return defaultValue;
-    
-        auto json = JSON::parse(file);
-        if (!json.isObject()) return defaultValue;
-        
-        if (auto* obj = json.getDynamicObject()) {
-            if (obj->hasProperty(key)) return obj->getProperty(key);
+        if (file.existsAsFile()) this->json = JSON::parse(file);
+        if (!this->json.isObject()) this->json = var{new DynamicObject()};
+    }
+
+    ~Settings() {
+        {
+            const std::lock_guard<std::mutex> lock{this->mutex};
+            this->exiting = true;
+        }
+        this->changed.notify_one();
+        if (this->flusher.joinable()) this->flusher.join();
+        this->write();
+    }
+
+private:
+    static auto getShared() -> SharedResourcePointer<Settings> {
+        auto shared = SharedResourcePointer<Settings>::getSharedObjectWithoutCreating();
+        // Hold a SharedResourcePointer<Settings> while using settings, otherwise every call loads the file again.
+        jassert(shared.has_value());
+        return shared.has_value() ? *shared : SharedResourcePointer<Settings>{};
+    }
+
+    auto run() -> void {
+        std::unique_lock<std::mutex> lock{this->mutex};
+        while (!this->exiting) {
+            this->changed.wait(lock, [this]() { return this->dirty || this->exiting; });
+            auto due = this->lastChange + std::chrono::milliseconds{flushDelayMs};
+            while (!this->exiting && std::chrono::steady_clock::now() < due) {
+                this->changed.wait_until(lock, due);
+                due = this->lastChange + std::chrono::milliseconds{flushDelayMs};
+            }
+            if (this->exiting) break;
+
+            lock.unlock();
+            this->write();
+            lock.lock();
         }
-    
-        return defaultValue;
     }
-};
\ No newline at end of file
+
+    auto write() -> bool {
+        String text;
+        {
+            const std::lock_guard<std::mutex> lock{this->mutex};
+            if (!this->dirty) return true;
+            text = JSON::toString(this->json, true);
+            this->dirty = false;
+        }
+
+        const std::lock_guard<std::mutex> lock{this->writeMutex};
+        auto file = getSettingsFile();
+        file.getParentDirectory().createDirectory();
+        TemporaryFile temp{file};
+        if (temp.getFile().replaceWithText(text) && temp.overwriteTargetFileWithTemporary()) return true;
+
+        const std::lock_guard<std::mutex> retry{this->mutex};
+        this->dirty = true;
+        this->lastChange = std::chrono::steady_clock::now();
+        return false;
+    }
+
+    std::mutex mutex;
+    std::mutex writeMutex;
+    std::condition_variable changed;
+    var json;
+    bool dirty = false;
+    bool exiting = false;
+    std::chrono::steady_clock::time_point lastChange;
+    std::thread flusher;
+};
@@ -0,0 +1,46 @@
+#pragma once
+#include <JuceHeader.h>
+#include "Functions.hpp"
+#include "BinaryData.h"
+
+class WebviewAssets {
+public:
+    using Bytes = std::shared_ptr<const std::vector<std::byte>>;
+
+    WebviewAssets() : loader([this]() { this->load(); }) {}
+
+    ~WebviewAssets() {
+        if (this->loader.joinable()) this->loader.join();
+    }
+
+    auto find(const String& path) const -> Bytes {
+        this->loaded.wait();
+        auto it = this->assets.find(path);
+        return it != this->assets.end() ? it->second : nullptr;
+    }
+
+private:
+    auto load() -> void {
+        MemoryInputStream zipStream{BinaryData::webview_files_zip, BinaryData::webview_files_zipSize, false};
+        ZipFile zip{zipStream};
+
+        for (int i = 0; i < zip.getNumEntries(); i++) {
+            auto* entry = zip.getEntry(i);
+            if (entry == nullptr || entry->filename.endsWithChar('/')) continue;
+
+            std::unique_ptr<InputStream> entryStream{zip.createStreamForEntry(i)};
+            if (entryStream == nullptr) {
+                jassertfalse;
+                continue;
+            }
+            this->assets.emplace(entry->filename, std::make_shared<const std::vector<std::byte>>(Functions::streamToVector(*entryStream)));
+        }
+        this->loaded.signal();
+    }
+
+    std::unordered_map<String, Bytes> assets;
+    WaitableEvent loaded{true};
+    std::thread loader;
+
+    JUCE_DECLARE_NON_COPYABLE(WebviewAssets)
+};
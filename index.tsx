@@ -11,17 +11,50 @@ const selectAudio = JUCE.getNativeFunction("selectAudio")
 const selectDest = JUCE.getNativeFunction("selectDest")
 const updateSkipVocalExtraction = JUCE.getNativeFunction("updateSkipVocalExtraction")
 const updateKeepVocalFile = JUCE.getNativeFunction("updateKeepVocalFile")
+const updateChopOptions = JUCE.getNativeFunction("updateChopOptions")
+const toggleCapture = JUCE.getNativeFunction("toggleCapture")
+const loadPreview = JUCE.getNativeFunction("loadPreview")
+const playChop = JUCE.getNativeFunction("playChop")
+const stopPreview = JUCE.getNativeFunction("stopPreview")
 const startProcessing = JUCE.getNativeFunction("startProcessing")
 const openFolder = JUCE.getNativeFunction("openFolder")
 const showFileInFolder = JUCE.getNativeFunction("showFileInFolder")
+const beginFileDrop = JUCE.getNativeFunction("beginFileDrop")
+const appendFileDrop = JUCE.getNativeFunction("appendFileDrop")
+const endFileDrop = JUCE.getNativeFunction("endFileDrop")
+
+const dropChunkSize = 3 * 1024 * 1024
+
+const readBase64 = (blob: Blob) => {
+    return new Promise<string>((resolve, reject) => {
+        const reader = new FileReader()
+        reader.onload = () => resolve((reader.result as string).split(",")[1] ?? "")
+        reader.onerror = () => reject(reader.error)
+        reader.readAsDataURL(blob)
+    })
+}
+
+const formatEta = (seconds: number) => {
+    const total = Math.ceil(seconds)
+    const minutes = Math.floor(total / 60)
+    return `${minutes}:${String(total % 60).padStart(2, "0")}`
+}
 
 const App: React.FunctionComponent = () => {
     const [audioPath, setAudioPath] = useState("")
     const [destPath, setDestPath] = useState("")
     const [skipVocalExtraction, setSkipVocalExtraction] = useState(false)
     const [keepVocalFile, setKeepVocalFile] = useState(false)
+    const [threshold, setThreshold] = useState(0.5)
+    const [minDuration, setMinDuration] = useState(0.2)
+    const [minRms, setMinRms] = useState(0.01)
     const [state, setState] = useState("")
     const [progress, setProgress] = useState(100)
+    const [capturing, setCapturing] = useState(false)
+    const [chops, setChops] = useState([] as {index: number, name: string, duration: number}[])
+    const [queue, setQueue] = useState({completed: 0, total: 0, eta: -1})
+    const [activeJob, setActiveJob] = useState("")
+    const [error, setError] = useState("")
 
     useEffect(() => {
         window.__JUCE__.backend.addEventListener("state-changed", (state: string) => {
@@ -33,8 +66,21 @@ const App: React.FunctionComponent = () => {
                 return percent >= prev ? percent : prev
             })
         })
-        window.__JUCE__.backend.addEventListener("dropped-file", (file: string) => {
-            setAudioPath(file)
+        window.__JUCE__.backend.addEventListener("queue-changed", (queue: {completed: number, total: number, eta: number}) => {
+            setQueue(queue)
+        })
+        window.__JUCE__.backend.addEventListener("job-changed", async (job: {name: string, state: string, outputFolder: string, error: string}) => {
+            if (["provisioning", "separating", "chopping"].includes(job.state)) {
+                setActiveJob(job.name)
+                setError("")
+            }
+            if (job.state === "failed" && job.error) setError(`${job.name}: ${job.error}`)
+            if (job.state === "finished" && job.outputFolder) setChops(await loadPreview(job.outputFolder))
+        })
+        window.__JUCE__.backend.addEventListener("capture-changed", async (capture: {capturing: boolean, audioPath: string, chopsFolder?: string}) => {
+            setCapturing(capture.capturing)
+            if (capture.audioPath) setAudioPath(capture.audioPath)
+            if (capture.chopsFolder) setChops(await loadPreview(capture.chopsFolder))
         })
         window.addEventListener("dragenter", cancelEvent)
         window.addEventListener("dragover", cancelEvent)
@@ -49,7 +95,17 @@ const App: React.FunctionComponent = () => {
         setDestPath(state.destPath)
         setSkipVocalExtraction(state.skipVocalExtraction)
         setKeepVocalFile(state.keepVocalFile)
-        setState(state.state === "finished" ? "" : state)
+        setCapturing(state.capturing)
+        if (state.missing?.length) setError(`Missing ${state.missing.join(", ")}`)
+        setChops(state.chops)
+        setThreshold(state.threshold)
+        setMinDuration(state.minDuration)
+        setMinRms(state.minRms)
+        setState(state.state === "finished" ? "" : state.state)
+        const jobs = state.jobs as {name: string, state: string}[]
+        const active = ["provisioning", "separating", "chopping"]
+        setQueue({completed: jobs.filter((job) => !["queued", ...active].includes(job.state)).length, total: jobs.length, eta: -1})
+        setActiveJob(jobs.find((job) => active.includes(job.state))?.name ?? "")
         setProgress((prev) => {
             if (prev === 100) return state.progress
             return state.progress >= prev ? state.progress : prev
@@ -61,6 +117,12 @@ const App: React.FunctionComponent = () => {
         if (audio) setAudioPath(audio)
     }
 
+    const onToggleCapture = async () => {
+        const result = await toggleCapture()
+        setCapturing(result.capturing)
+        if (result.audioPath) setAudioPath(result.audioPath)
+    }
+
     const onSelectDest = async () => {
         const dest = await selectDest()
         if (dest) setDestPath(dest)
@@ -78,15 +140,31 @@ const App: React.FunctionComponent = () => {
         setKeepVocalFile(newValue)
     }
 
+    const changeChopOption = (setter: (value: number) => void, index: number) => (event: React.ChangeEvent<HTMLInputElement>) => {
+        const value = Number(event.target.value)
+        if (Number.isNaN(value)) return
+        setter(value)
+        const options = [threshold, minDuration, minRms]
+        options[index] = value
+        updateChopOptions(...options)
+    }
+
     const onStartProcessing = async () => {
-        await startProcessing()
+        const result = await startProcessing()
+        if (result?.missing?.length) setError(`Missing ${result.missing.join(", ")}`)
     }
 
     const getProgressText = () => {
-        if (state === "separating") {
-            return "Separating Vocals..."
+        const batch = queue.total > 1 ? ` (${activeJob} ${queue.completed + 1}/${queue.total})` : ""
+        const eta = queue.eta > 0 ? ` ${formatEta(queue.eta)} left` : ""
+        if (state === "provisioning") {
+            return `Installing Python Dependencies${batch}...`
+        } else if (state === "separating") {
+            return `Separating Vocals${batch}...${eta}`
         } else if (state === "chopping") {
-            return "Chopping Vocals..."
+            return `Chopping Vocals${batch}...${eta}`
+        } else if (error) {
+            return `Failed - ${error}`
         } else {
             return "Waiting..."
         }
@@ -99,15 +177,22 @@ const App: React.FunctionComponent = () => {
     const dropEvent = async (event: DragEvent) => {
         event.preventDefault()
         if (!event.dataTransfer?.files.length) return
-        const file = event.dataTransfer.files[0]
         const accepted = [".wav", ".mp3", ".ogg", ".flac"]
-        if (accepted.some(ext => file.name.endsWith(ext))) {
-            const buffer = await file.arrayBuffer()
-            window.__JUCE__.backend.emitEvent("file-dropped", {
-                name: file.name,
-                data: Object.values(new Uint8Array(buffer))
-            })
-            setAudioPath(`[dropped file] ${file.name}`)
+        const files = Array.from(event.dataTransfer.files).filter((file) => accepted.some(ext => file.name.endsWith(ext)))
+        for (let i = 0; i < files.length; i++) {
+            const file = files[i]
+            if (!await beginFileDrop(file.name, file.size, i === 0)) continue
+            let failed = false
+            for (let offset = 0; offset < file.size; offset += dropChunkSize) {
+                const chunk = await readBase64(file.slice(offset, offset + dropChunkSize))
+                if (await appendFileDrop(chunk) === false) {
+                    failed = true
+                    break
+                }
+            }
+            if (failed) continue
+            const result = await endFileDrop(file.name)
+            if (result) setAudioPath(result.audioPath)
         }
     }
 
@@ -128,6 +213,7 @@ const App: React.FunctionComponent = () => {
                 <div className="column">
                     <input className="input" type="text" value={audioPath} placeholder="Select audio file..." readOnly onDoubleClick={showFile}></input>
                     <button className="button" onClick={onSelectAudio}><span>Select Audio</span></button>
+                    <button className={capturing ? "button button-active" : "button"} onClick={onToggleCapture}><span>{capturing ? "Stop" : "Capture"}</span></button>
                 </div>
                 <div className="column-start">
                     <input id="checkbox" className="checkbox-input" type="checkbox" checked={skipVocalExtraction} onClick={toggleSkipVocalExtraction}/>
@@ -137,6 +223,14 @@ const App: React.FunctionComponent = () => {
                     <label htmlFor="checkbox2" className="checkbox-square"></label>
                     <span className="checkbox-text">Keep Vocal File</span>
                 </div>
+                <div className="column-start">
+                    <span className="checkbox-text option-text">Threshold</span>
+                    <input className="input option-input" type="number" min={0} max={1} step={0.05} value={threshold} onChange={changeChopOption(setThreshold, 0)}></input>
+                    <span className="checkbox-text option-text">Min Duration</span>
+                    <input className="input option-input" type="number" min={0} step={0.05} value={minDuration} onChange={changeChopOption(setMinDuration, 1)}></input>
+                    <span className="checkbox-text option-text">Min RMS</span>
+                    <input className="input option-input" type="number" min={0} step={0.005} value={minRms} onChange={changeChopOption(setMinRms, 2)}></input>
+                </div>
                 <div className="column">
                     <input className="input" type="text" value={destPath} placeholder="Select destination folder..." readOnly onDoubleClick={folderOpen}></input>
                     <button className="button" onClick={onSelectDest}><span>Select Dest</span></button>
@@ -145,6 +239,11 @@ const App: React.FunctionComponent = () => {
             <div className="column">
                 <button className={state ? "button-big-alt" : "button-big"} onClick={onStartProcessing}><span>{state ? "Stop" : "Generate"}</span></button>
             </div>
+            {chops.length ? <div className="chop-list">
+                {chops.map((chop) => <button key={chop.index} className="chop-button" onClick={() => playChop(chop.index)}>
+                    <span>{chop.index}</span></button>)}
+                <button className="chop-button" onClick={() => stopPreview()}><span>Stop</span></button>
+            </div> : null}
             <div className="column">
                 <div className="progress-container">
                     <span className="progress-text">{getProgressText()}</span>
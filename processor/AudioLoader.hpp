@@ -0,0 +1,77 @@
+#pragma once
+#include <JuceHeader.h>
+
+class AudioLoader {
+public:
+    static constexpr int blockSize = 1 << 16;
+    static constexpr int64 maxSamples = std::numeric_limits<int>::max();
+
+    static auto createReader(const File& file) -> std::unique_ptr<AudioFormatReader> {
+        std::unique_ptr<MemoryMappedAudioFormatReader> mapped;
+        if (file.hasFileExtension("wav;wave")) {
+            WavAudioFormat format;
+            mapped.reset(format.createMemoryMappedReader(file));
+        } else if (file.hasFileExtension("aif;aiff")) {
+            AiffAudioFormat format;
+            mapped.reset(format.createMemoryMappedReader(file));
+        }
+        if (mapped != nullptr && mapped->mapEntireFile()) return mapped;
+
+        AudioFormatManager formatManager;
+        formatManager.registerBasicFormats();
+        return std::unique_ptr<AudioFormatReader>{formatManager.createReaderFor(file)};
+    }
+
+    using BlockCallback = std::function<bool(const float* samples, int numSamples)>;
+
+    static auto getMonoLength(PositionableAudioSource& source, double sourceRate, double sampleRate) -> int64 {
+        return static_cast<int64>(std::ceil(static_cast<double>(source.getTotalLength()) * sampleRate / sourceRate));
+    }
+
+    // Mixes down and resamples numSamples from start (both at sampleRate) one block at a time, so the take is never
+    // decoded whole. Stops early when onBlock returns false.
+    static auto streamMono(PositionableAudioSource& source, int numChannels, double sourceRate, double sampleRate,
+        int64 start, int64 numSamples, const BlockCallback& onBlock) -> void {
+        auto ratio = sourceRate / sampleRate;
+        auto size = static_cast<int>(jmin<int64>(blockSize, jmax<int64>(1, numSamples)));
+        source.setNextReadPosition(static_cast<int64>(std::round(static_cast<double>(start) * ratio)));
+
+        ResamplingAudioSource resampler{&source, false, numChannels};
+        resampler.setResamplingRatio(ratio);
+        resampler.prepareToPlay(size, sampleRate);
+
+        AudioBuffer<float> block{numChannels, size};
+        AudioBuffer<float> mono{1, size};
+        for (int64 position = 0; position < numSamples; position += size) {
+            auto length = static_cast<int>(jmin<int64>(size, numSamples - position));
+            AudioSourceChannelInfo info{&block, 0, length};
+            if (ratio == 1.0) {
+                source.getNextAudioBlock(info);
+            } else {
+                resampler.getNextAudioBlock(info);
+            }
+            mixDown(block, mono, 0, length);
+            if (!onBlock(mono.getReadPointer(0), length)) break;
+        }
+        resampler.releaseResources();
+    }
+
+    // The whole file at its native rate and channel count, for separation and chop previews.
+    static auto loadNative(const File& file, double& sampleRate) -> std::optional<AudioBuffer<float>> {
+        auto reader = createReader(file);
+        if (reader == nullptr || reader->lengthInSamples <= 0 || reader->lengthInSamples > maxSamples) return std::nullopt;
+
+        AudioBuffer<float> output{static_cast<int>(reader->numChannels), static_cast<int>(reader->lengthInSamples)};
+        if (!reader->read(&output, 0, output.getNumSamples(), 0, true, true)) return std::nullopt;
+        sampleRate = reader->sampleRate;
+        return output;
+    }
+
+private:
+    static auto mixDown(const AudioBuffer<float>& block, AudioBuffer<float>& output, int position, int numSamples) -> void {
+        auto numChannels = block.getNumChannels();
+        output.copyFrom(0, position, block, 0, 0, numSamples);
+        for (int ch = 1; ch < numChannels; ch++) output.addFrom(0, position, block, ch, 0, numSamples);
+        if (numChannels > 1) output.applyGain(0, position, numSamples, 1.0f / static_cast<float>(numChannels));
+    }
+};
@@ -0,0 +1,135 @@
+#include "CaptureRecorder.h"
+
+CaptureRecorder::~CaptureRecorder() {
+    this->stop();
+}
+
+auto CaptureRecorder::getCaptureFolder() -> File {
+    return File::getSpecialLocation(File::userApplicationDataDirectory)
+        .getChildFile(JucePlugin_Manufacturer)
+        .getChildFile(JucePlugin_Name)
+        .getChildFile("captures");
+}
+
+auto CaptureRecorder::createTakeFile() -> File {
+    auto folder = getCaptureFolder();
+    folder.createDirectory();
+    return folder.getChildFile("take " + Time::getCurrentTime().formatted("%Y-%m-%d %H-%M-%S") + ".wav")
+        .getNonexistentSibling();
+}
+
+auto CaptureRecorder::prepare(double newSampleRate, int samplesPerBlock, int newNumChannels) -> void {
+    const ScopedLock sl{this->lock};
+    auto capacity = jmax(samplesPerBlock * 4, static_cast<int>(newSampleRate * bufferSeconds)) + 1;
+
+    // A take survives a block size change, the drain thread is paused while the ring grows.
+    if (this->isRecording()) {
+        if (!this->canContinue(newSampleRate, newNumChannels)) {
+            this->stop();
+        } else {
+            if (capacity <= this->fifo.getTotalSize()) return;
+            while (this->pushing.load() > 0) std::this_thread::yield();
+            this->stopThread(-1);
+            this->drain();
+            this->ring.setSize(jmax(1, this->numChannels), capacity);
+            this->ring.clear();
+            this->fifo.setTotalSize(capacity);
+            this->startThread();
+            return;
+        }
+    }
+
+    this->sampleRate = newSampleRate;
+    this->numChannels = jlimit(0, maxChannels, newNumChannels);
+    this->ring.setSize(jmax(1, this->numChannels), capacity);
+    this->ring.clear();
+    this->fifo.setTotalSize(capacity);
+}
+
+auto CaptureRecorder::canContinue(double newSampleRate, int newNumChannels) const -> bool {
+    if (!this->isRecording()) return true;
+    return newSampleRate == this->sampleRate && jlimit(0, maxChannels, newNumChannels) == this->numChannels;
+}
+
+auto CaptureRecorder::push(const AudioBuffer<float>& buffer) noexcept -> void {
+    this->pushing.fetch_add(1);
+    if (this->recording.load() && buffer.getNumChannels() > 0) {
+        auto numSamples = buffer.getNumSamples();
+        auto scope = this->fifo.write(numSamples);
+
+        for (int channel = 0; channel < this->numChannels; channel++) {
+            auto source = jmin(channel, buffer.getNumChannels() - 1);
+            if (scope.blockSize1 > 0) this->ring.copyFrom(channel, scope.startIndex1, buffer, source, 0, scope.blockSize1);
+            if (scope.blockSize2 > 0) this->ring.copyFrom(channel, scope.startIndex2, buffer, source, scope.blockSize1, scope.blockSize2);
+        }
+
+        auto written = scope.blockSize1 + scope.blockSize2;
+        if (written < numSamples) this->droppedSamples.fetch_add(numSamples - written, std::memory_order_relaxed);
+    }
+    this->pushing.fetch_sub(1);
+}
+
+auto CaptureRecorder::start(const File& takeFile, SampleCallback callback) -> bool {
+    const ScopedLock sl{this->lock};
+    if (this->isRecording() || this->numChannels == 0) return false;
+
+    this->file = takeFile;
+    this->onSamples = std::move(callback);
+
+    auto stream = std::make_unique<FileOutputStream>(this->file);
+    if (!stream->openedOk()) return false;
+
+    WavAudioFormat format;
+    this->writer.reset(format.createWriterFor(stream.get(), this->sampleRate, static_cast<unsigned int>(this->numChannels), 24, {}, 0));
+    if (this->writer == nullptr) {
+        this->file.deleteFile();
+        return false;
+    }
+    stream.release();
+
+    this->fifo.reset();
+    this->droppedSamples = 0;
+    this->recordedSamples = 0;
+    this->recording.store(true);
+    this->startThread();
+    return true;
+}
+
+auto CaptureRecorder::stop() -> File {
+    const ScopedLock sl{this->lock};
+    if (!this->isRecording()) return {};
+
+    this->recording.store(false);
+    while (this->pushing.load() > 0) std::this_thread::yield();
+    this->stopThread(-1);
+
+    this->drain();
+    this->writer.reset();
+    this->onSamples = nullptr;
+    return this->file;
+}
+
+auto CaptureRecorder::run() -> void {
+    while (!this->threadShouldExit()) {
+        this->drain();
+        this->wait(drainIntervalMs);
+    }
+}
+
+auto CaptureRecorder::drain() -> void {
+    if (this->writer == nullptr) return;
+    auto scope = this->fifo.read(this->fifo.getNumReady());
+
+    auto write = [&](int start, int size) {
+        if (size <= 0) return;
+        std::array<const float*, maxChannels> channels{};
+        for (int channel = 0; channel < this->numChannels; channel++) {
+            channels[static_cast<size_t>(channel)] = this->ring.getReadPointer(channel, start);
+        }
+        this->writer->writeFromFloatArrays(channels.data(), this->numChannels, size);
+        if (this->onSamples) this->onSamples(channels.data(), this->numChannels, size);
+        this->recordedSamples.fetch_add(size, std::memory_order_relaxed);
+    };
+    write(scope.startIndex1, scope.blockSize1);
+    write(scope.startIndex2, scope.blockSize2);
+}
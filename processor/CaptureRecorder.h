@@ -0,0 +1,47 @@
+#pragma once
+#include <JuceHeader.h>
+
+class CaptureRecorder : private Thread {
+public:
+    static constexpr int maxChannels = 2;
+    static constexpr double bufferSeconds = 4.0;
+    static constexpr int drainIntervalMs = 10;
+
+    CaptureRecorder() : Thread("Capture Thread") {}
+    ~CaptureRecorder() override;
+
+    using SampleCallback = std::function<void(const float* const*, int, int)>;
+
+    static auto getCaptureFolder() -> File;
+    static auto createTakeFile() -> File;
+
+    auto prepare(double sampleRate, int samplesPerBlock, int numChannels) -> void;
+    auto canContinue(double sampleRate, int numChannels) const -> bool;
+    auto push(const AudioBuffer<float>& buffer) noexcept -> void;
+
+    auto start(const File& takeFile, SampleCallback onSamples = nullptr) -> bool;
+    auto stop() -> File;
+    auto isRecording() const -> bool { return this->recording.load(std::memory_order_acquire); }
+    auto getSampleRate() const -> double { return this->sampleRate; }
+    auto getDroppedSamples() const -> int64 { return this->droppedSamples.load(std::memory_order_relaxed); }
+    auto getRecordedSamples() const -> int64 { return this->recordedSamples.load(std::memory_order_relaxed); }
+
+private:
+    auto run() -> void override;
+    auto drain() -> void;
+
+    AudioBuffer<float> ring;
+    AbstractFifo fifo{1};
+    std::unique_ptr<AudioFormatWriter> writer;
+    File file;
+    SampleCallback onSamples;
+    double sampleRate = 44100.0;
+    int numChannels = 0;
+    std::atomic<bool> recording{false};
+    std::atomic<int> pushing{0};
+    std::atomic<int64> droppedSamples{0};
+    std::atomic<int64> recordedSamples{0};
+    CriticalSection lock;
+
+    JUCE_DECLARE_NON_COPYABLE(CaptureRecorder)
+};
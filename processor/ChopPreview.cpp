@@ -0,0 +1,157 @@
+#include "ChopPreview.h"
+#include "AudioLoader.hpp"
+
+ChopPreview::~ChopPreview() {
+    this->clear();
+}
+
+auto ChopPreview::prepare(double newSampleRate, int samplesPerBlock) -> void {
+    this->sampleRate = newSampleRate;
+    this->scratch.assign(static_cast<size_t>(jmax(samplesPerBlock, 512)), 0.0f);
+    for (auto& voice : this->voices) voice.chop = nullptr;
+}
+
+auto ChopPreview::load(const File& folder) -> int {
+    auto bank = std::make_unique<Bank>();
+    bank->folder = folder;
+
+    for (auto& file : folder.findChildFiles(File::findFiles, false, "chop*.wav")) {
+        Chop chop;
+        auto loaded = AudioLoader::loadNative(file, chop.sampleRate);
+        if (!loaded.has_value() || loaded->getNumChannels() == 0) continue;
+        if (loaded->getNumChannels() > maxChannels) loaded->setSize(maxChannels, loaded->getNumSamples(), true);
+
+        chop.index = file.getFileNameWithoutExtension().fromFirstOccurrenceOf("chop", false, false).getIntValue();
+        chop.name = file.getFileName();
+        chop.audio = std::move(*loaded);
+        bank->chops.push_back(std::move(chop));
+    }
+    std::sort(bank->chops.begin(), bank->chops.end(), [](auto& a, auto& b) { return a.index < b.index; });
+
+    auto numChops = static_cast<int>(bank->chops.size());
+    this->publish(std::move(bank));
+    return numChops;
+}
+
+auto ChopPreview::clear() -> void {
+    this->publish(nullptr);
+}
+
+auto ChopPreview::publish(std::unique_ptr<Bank> bank) -> void {
+    const ScopedLock sl{this->lock};
+    if (bank != nullptr) bank->generation = ++this->generationCounter;
+    this->current.store(bank.get());
+    while (this->rendering.load() > 0) std::this_thread::yield();
+    this->owned = std::move(bank);
+}
+
+auto ChopPreview::trigger(int index) -> bool {
+    const ScopedLock sl{this->lock};
+    auto scope = this->triggerFifo.write(1);
+    if (scope.blockSize1 > 0) this->triggers[static_cast<size_t>(scope.startIndex1)] = index;
+    else if (scope.blockSize2 > 0) this->triggers[static_cast<size_t>(scope.startIndex2)] = index;
+    return scope.blockSize1 + scope.blockSize2 > 0;
+}
+
+auto ChopPreview::stop() -> void {
+    this->trigger(stopAllVoices);
+}
+
+auto ChopPreview::getFolder() const -> File {
+    const ScopedLock sl{this->lock};
+    return this->owned != nullptr ? this->owned->folder : File{};
+}
+
+auto ChopPreview::getChops() const -> Array<var> {
+    const ScopedLock sl{this->lock};
+    Array<var> chops;
+    if (this->owned == nullptr) return chops;
+
+    for (auto& chop : this->owned->chops) {
+        auto* obj = new DynamicObject();
+        obj->setProperty("index", chop.index);
+        obj->setProperty("name", chop.name);
+        obj->setProperty("duration", chop.audio.getNumSamples() / chop.sampleRate);
+        chops.add(var{obj});
+    }
+    return chops;
+}
+
+auto ChopPreview::startVoice(const Bank& bank, int index) noexcept -> void {
+    if (index == stopAllVoices) {
+        for (auto& voice : this->voices) voice.chop = nullptr;
+        return;
+    }
+    auto it = std::find_if(bank.chops.begin(), bank.chops.end(), [&](auto& chop) { return chop.index == index; });
+    if (it == bank.chops.end()) return;
+
+    auto* voice = &this->voices.front();
+    for (auto& candidate : this->voices) {
+        if (candidate.chop == nullptr) {
+            voice = &candidate;
+            break;
+        }
+        if (candidate.started < voice->started) voice = &candidate;
+    }
+    voice->chop = &*it;
+    voice->generation = bank.generation;
+    voice->position = 0;
+    voice->started = ++this->voiceCounter;
+    for (auto& interpolator : voice->interpolators) interpolator.reset();
+}
+
+auto ChopPreview::render(AudioBuffer<float>& buffer) noexcept -> void {
+    this->rendering.fetch_add(1);
+    auto* bank = this->current.load();
+
+    auto pending = this->triggerFifo.read(this->triggerFifo.getNumReady());
+    if (bank != nullptr) {
+        for (int i = 0; i < pending.blockSize1; i++) this->startVoice(*bank, this->triggers[static_cast<size_t>(pending.startIndex1 + i)]);
+        for (int i = 0; i < pending.blockSize2; i++) this->startVoice(*bank, this->triggers[static_cast<size_t>(pending.startIndex2 + i)]);
+    }
+
+    auto numSamples = buffer.getNumSamples();
+    auto maxChunk = static_cast<int>(this->scratch.size());
+    for (auto& voice : this->voices) {
+        if (voice.chop == nullptr) continue;
+        if (bank == nullptr || voice.generation != bank->generation || maxChunk == 0) {
+            voice.chop = nullptr;
+            continue;
+        }
+
+        auto ratio = voice.chop->sampleRate / this->sampleRate;
+        auto length = voice.chop->audio.getNumSamples();
+        auto numChannels = voice.chop->audio.getNumChannels();
+        auto numOutputs = buffer.getNumChannels();
+
+        for (int offset = 0; offset < numSamples && voice.chop != nullptr;) {
+            auto available = length - voice.position;
+            auto numOut = jmin(numSamples - offset, maxChunk, static_cast<int>(std::ceil(available / ratio)));
+            if (numOut <= 0) {
+                voice.chop = nullptr;
+                break;
+            }
+
+            // Mono chops play on every output, chops with more channels than the bus fold down into it.
+            auto used = 0;
+            for (int channel = 0; channel < numChannels; channel++) {
+                auto* samples = voice.chop->audio.getReadPointer(channel, voice.position);
+                used = voice.interpolators[static_cast<size_t>(channel)].process(ratio, samples, this->scratch.data(), numOut, available, 0);
+                if (numChannels >= numOutputs) {
+                    if (numOutputs > 0) {
+                        FloatVectorOperations::addWithMultiply(buffer.getWritePointer(channel % numOutputs, offset), this->scratch.data(), 
+                            static_cast<float>(numOutputs) / static_cast<float>(numChannels), numOut);
+                    }
+                } else {
+                    for (int output = channel; output < numOutputs; output += numChannels) {
+                        FloatVectorOperations::add(buffer.getWritePointer(output, offset), this->scratch.data(), numOut);
+                    }
+                }
+            }
+            voice.position += used;
+            offset += numOut;
+            if (voice.position >= length) voice.chop = nullptr;
+        }
+    }
+    this->rendering.fetch_sub(1);
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include <JuceHeader.h>
+
+class ChopPreview {
+public:
+    static constexpr int maxVoices = 16;
+    static constexpr int maxChannels = 8;
+    static constexpr int maxPendingTriggers = 256;
+    static constexpr int stopAllVoices = -1;
+
+    struct Chop {
+        int index = 0;
+        String name = "";
+        AudioBuffer<float> audio;
+        double sampleRate = 0.0;
+    };
+
+    ChopPreview() = default;
+    ~ChopPreview();
+
+    auto prepare(double sampleRate, int samplesPerBlock) -> void;
+    auto load(const File& folder) -> int;
+    auto clear() -> void;
+    auto trigger(int index) -> bool;
+    auto stop() -> void;
+    auto render(AudioBuffer<float>& buffer) noexcept -> void;
+
+    auto getFolder() const -> File;
+    auto getChops() const -> Array<var>;
+
+private:
+    struct Bank {
+        uint32 generation = 0;
+        File folder;
+        std::vector<Chop> chops;
+    };
+
+    struct Voice {
+        const Chop* chop = nullptr;
+        uint32 generation = 0;
+        int position = 0;
+        uint32 started = 0;
+        std::array<LagrangeInterpolator, maxChannels> interpolators;
+    };
+
+    auto publish(std::unique_ptr<Bank> bank) -> void;
+    auto startVoice(const Bank& bank, int index) noexcept -> void;
+
+    std::atomic<Bank*> current{nullptr};
+    std::unique_ptr<Bank> owned;
+    std::atomic<int> rendering{0};
+    std::array<Voice, maxVoices> voices;
+    std::array<int, maxPendingTriggers> triggers = {};
+    AbstractFifo triggerFifo{maxPendingTriggers};
+    std::vector<float> scratch;
+    double sampleRate = 44100.0;
+    uint32 voiceCounter = 0;
+    uint32 generationCounter = 0;
+    CriticalSection lock;
+
+    JUCE_DECLARE_NON_COPYABLE(ChopPreview)
+};
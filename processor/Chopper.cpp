@@ -0,0 +1,237 @@
+#include "Chopper.h"
+#include "AudioLoader.hpp"
+
+auto Chopper::findRegions(const std::vector<float>& conf, double sampleRate, const Options& options) -> std::vector<ChopRegion> {
+    auto toSamples = [&](int frame) { return static_cast<int>(frame * options.hopSeconds * sampleRate); };
+    std::vector<ChopRegion> regions;
+    int start = -1;
+    int end = -1;
+
+    for (int frame = 0; frame < static_cast<int>(conf.size()); frame++) {
+        if (conf[static_cast<size_t>(frame)] <= options.threshold) continue;
+
+        if (start < 0) {
+            start = frame;
+        } else if (frame - end > options.maxGap) {
+            regions.push_back({static_cast<int>(regions.size()), toSamples(start), toSamples(end)});
+            start = frame;
+        }
+        end = frame;
+    }
+    if (start >= 0) regions.push_back({static_cast<int>(regions.size()), toSamples(start), toSamples(end)});
+    return regions;
+}
+
+auto Chopper::framePowers(const float* samples, int numSamples) -> std::vector<double> {
+    std::vector<double> prefix(static_cast<size_t>(numSamples) + 1, 0.0);
+    for (int i = 0; i < numSamples; i++) {
+        prefix[static_cast<size_t>(i) + 1] = prefix[static_cast<size_t>(i)] + static_cast<double>(samples[i]) * samples[i];
+    }
+
+    auto numFrames = 1 + numSamples / rmsHopLength;
+    std::vector<double> powers(static_cast<size_t>(numFrames));
+    for (int t = 0; t < numFrames; t++) {
+        auto low = jlimit(0, numSamples, t * rmsHopLength - rmsFrameLength / 2);
+        auto high = jlimit(0, numSamples, t * rmsHopLength + rmsFrameLength / 2);
+        powers[static_cast<size_t>(t)] = (prefix[static_cast<size_t>(high)] - prefix[static_cast<size_t>(low)]) / rmsFrameLength;
+    }
+    return powers;
+}
+
+auto Chopper::meanRms(const float* samples, int numSamples) -> double {
+    auto powers = framePowers(samples, numSamples);
+    double sum = 0.0;
+    for (auto power : powers) sum += std::sqrt(power);
+    return sum / static_cast<double>(powers.size());
+}
+
+auto Chopper::trim(const float* samples, int numSamples) -> Range<int> {
+    constexpr double amin = 1e-10;
+    auto powers = framePowers(samples, numSamples);
+    auto reference = 10.0 * std::log10(jmax(amin, *std::max_element(powers.begin(), powers.end())));
+
+    int first = -1;
+    int last = -1;
+    for (int t = 0; t < static_cast<int>(powers.size()); t++) {
+        if (10.0 * std::log10(jmax(amin, powers[static_cast<size_t>(t)])) - reference > -trimTopDb) {
+            if (first < 0) first = t;
+            last = t;
+        }
+    }
+    if (first < 0) return {};
+    return {first * rmsHopLength, jmin(numSamples, (last + 1) * rmsHopLength)};
+}
+
+auto Chopper::getOutputFolder(const File& destFolder, const String& name, int index) -> File {
+    auto baseName = File::createFileWithoutCheckingPath(name).getFileNameWithoutExtension();
+    if (index > 1) baseName << " (" << index << ")";
+    return destFolder.getChildFile(baseName + " chops");
+}
+
+auto Chopper::writeChop(const File& file, const float* samples, int numSamples, double sampleRate) -> bool {
+    file.deleteFile();
+    auto stream = std::make_unique<FileOutputStream>(file);
+    if (!stream->openedOk()) return false;
+
+    WavAudioFormat format;
+    std::unique_ptr<AudioFormatWriter> writer{format.createWriterFor(stream.get(), sampleRate, 1, 16, {}, 0)};
+    if (writer == nullptr) return false;
+    stream.release();
+
+    return writer->writeFromFloatArrays(&samples, 1, numSamples);
+}
+
+auto Chopper::writeChop(const File& file, const AudioBuffer<float>& audio, double sampleRate, int bitsPerSample) -> bool {
+    file.deleteFile();
+    auto stream = std::make_unique<FileOutputStream>(file, writeBufferSize);
+    if (!stream->openedOk()) return false;
+
+    WavAudioFormat format;
+    auto numChannels = static_cast<unsigned int>(audio.getNumChannels());
+    std::unique_ptr<AudioFormatWriter> writer{format.createWriterFor(stream.get(), sampleRate, numChannels, bitsPerSample, {}, 0)};
+    if (writer == nullptr) return false;
+    stream.release();
+
+    return writer->writeFromAudioSampleBuffer(audio, 0, audio.getNumSamples());
+}
+
+auto Chopper::selectChop(const float* samples, int numSamples, double sampleRate, const Options& options) -> std::optional<Range<int>> {
+    auto minLength = static_cast<int>(options.minDuration * sampleRate);
+    if (numSamples <= 0 || numSamples < minLength || meanRms(samples, numSamples) < options.minRms) return std::nullopt;
+    return trim(samples, numSamples);
+}
+
+// Each region's window is read from the source on its own, the analysis signal is never held whole.
+auto Chopper::selectChops(PositionableAudioSource& source, int numChannels, double sourceRate, double analysisRate,
+    const std::vector<ChopRegion>& regions, const Options& options) -> std::vector<ChopRegion> {
+    auto total = AudioLoader::getMonoLength(source, sourceRate, analysisRate);
+    std::vector<ChopRegion> chops;
+    std::vector<float> window;
+    for (auto& region : regions) {
+        auto start = jlimit<int64>(0, total, region.start);
+        auto length = static_cast<int>(jlimit<int64>(start, total, region.end) - start);
+        window.resize(static_cast<size_t>(length));
+
+        size_t filled = 0;
+        AudioLoader::streamMono(source, numChannels, sourceRate, analysisRate, start, length, [&](const float* samples, int numSamples) {
+            std::copy(samples, samples + numSamples, window.begin() + static_cast<std::ptrdiff_t>(filled));
+            filled += static_cast<size_t>(numSamples);
+            return true;
+        });
+
+        auto range = selectChop(window.data(), length, analysisRate, options);
+        if (!range.has_value() || range->isEmpty()) continue;
+        chops.push_back({region.index, static_cast<int>(start) + range->getStart(), static_cast<int>(start) + range->getEnd()});
+    }
+    return chops;
+}
+
+auto Chopper::exportChop(const float* samples, int numSamples, double sampleRate, const File& outputFolder, 
+    int index, const Options& options) -> bool {
+    auto range = selectChop(samples, numSamples, sampleRate, options);
+    if (!range.has_value()) return false;
+
+    auto file = outputFolder.getChildFile("chop" + String{index} + ".wav");
+    return writeChop(file, samples + range->getStart(), range->getLength(), sampleRate);
+}
+
+auto Chopper::exportSourceChops(const File& source, double analysisRate, const std::vector<ChopRegion>& chops,
+    const File& outputFolder, int numThreads) -> int {
+    if (outputFolder.exists()) outputFolder.deleteRecursively();
+    if (!outputFolder.createDirectory()) return -1;
+
+    std::vector<std::unique_ptr<AudioFormatReader>> readers;
+    readers.push_back(AudioLoader::createReader(source));
+    if (readers.front() == nullptr) return -1;
+    if (chops.empty()) return 0;
+
+    auto& first = *readers.front();
+    auto ratio = first.sampleRate / analysisRate;
+    auto sampleRate = first.sampleRate;
+    auto length = first.lengthInSamples;
+    auto numChannels = static_cast<int>(first.numChannels);
+    auto bitsPerSample = jlimit(16, 24, static_cast<int>(first.bitsPerSample));
+    auto mapped = dynamic_cast<MemoryMappedAudioFormatReader*>(&first) != nullptr;
+
+    auto numChops = static_cast<int>(chops.size());
+    numThreads = jlimit(1, numChops, numThreads > 0 ? numThreads : SystemStats::getNumCpus());
+    for (int i = 1; mapped && i < numThreads; i++) readers.push_back(AudioLoader::createReader(source));
+
+    std::atomic<int> next = 0;
+    std::atomic<int> written = 0;
+    CriticalSection readLock;
+
+    auto worker = [&](AudioFormatReader& reader, bool shared) {
+        AudioBuffer<float> audio;
+        for (auto i = next++; i < numChops; i = next++) {
+            auto& chop = chops[static_cast<size_t>(i)];
+            auto start = jlimit<int64>(0, length, static_cast<int64>(std::round(chop.start * ratio)));
+            auto end = jlimit<int64>(start, length, static_cast<int64>(std::round(chop.end * ratio)));
+            if (end <= start) continue;
+
+            audio.setSize(numChannels, static_cast<int>(end - start), false, false, true);
+            bool ok = false;
+            if (shared) {
+                const ScopedLock sl{readLock};
+                ok = reader.read(&audio, 0, audio.getNumSamples(), start, true, true);
+            } else {
+                ok = reader.read(&audio, 0, audio.getNumSamples(), start, true, true);
+            }
+            auto file = outputFolder.getChildFile("chop" + String{chop.index} + ".wav");
+            if (ok && writeChop(file, audio, sampleRate, bitsPerSample)) written++;
+        }
+    };
+
+    std::vector<AudioFormatReader*> assigned{&first};
+    for (int i = 1; i < numThreads; i++) {
+        auto* reader = mapped ? readers[static_cast<size_t>(i)].get() : nullptr;
+        assigned.push_back(reader != nullptr ? reader : &first);
+    }
+    auto shared = std::count(assigned.begin(), assigned.end(), &first) > 1;
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < numThreads; i++) {
+        auto* reader = assigned[static_cast<size_t>(i)];
+        threads.emplace_back(worker, std::ref(*reader), shared && reader == &first);
+    }
+    worker(first, shared);
+    for (auto& thread : threads) thread.join();
+    return written.load();
+}
+
+auto Chopper::exportBufferChops(const AudioBuffer<float>& source, double sampleRate, double analysisRate,
+    const std::vector<ChopRegion>& chops, const File& outputFolder, int numThreads) -> int {
+    if (outputFolder.exists()) outputFolder.deleteRecursively();
+    if (!outputFolder.createDirectory()) return -1;
+    if (source.getNumSamples() == 0 || chops.empty()) return 0;
+
+    auto ratio = sampleRate / analysisRate;
+    auto length = source.getNumSamples();
+    auto numChannels = source.getNumChannels();
+    auto numChops = static_cast<int>(chops.size());
+    numThreads = jlimit(1, numChops, numThreads > 0 ? numThreads : SystemStats::getNumCpus());
+
+    std::atomic<int> next = 0;
+    std::atomic<int> written = 0;
+
+    auto worker = [&]() {
+        AudioBuffer<float> audio;
+        for (auto i = next++; i < numChops; i = next++) {
+            auto& chop = chops[static_cast<size_t>(i)];
+            auto start = jlimit(0, length, static_cast<int>(std::round(chop.start * ratio)));
+            auto end = jlimit(start, length, static_cast<int>(std::round(chop.end * ratio)));
+            if (end <= start) continue;
+
+            audio.setSize(numChannels, end - start, false, false, true);
+            for (int ch = 0; ch < numChannels; ch++) audio.copyFrom(ch, 0, source, ch, start, end - start);
+            auto file = outputFolder.getChildFile("chop" + String{chop.index} + ".wav");
+            if (writeChop(file, audio, sampleRate, 24)) written++;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < numThreads; i++) threads.emplace_back(worker);
+    worker();
+    for (auto& thread : threads) thread.join();
+    return written.load();
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <JuceHeader.h>
+
+struct ChopRegion {
+    int index = 0;
+    int start = 0;
+    int end = 0;
+};
+
+class Chopper {
+public:
+    struct Options {
+        float threshold = 0.5f;
+        double minDuration = 0.2;
+        double minRms = 0.01;
+        double hopSeconds = 0.01;
+        int maxGap = 3;
+    };
+
+    static constexpr int rmsFrameLength = 2048;
+    static constexpr int rmsHopLength = 512;
+    static constexpr double trimTopDb = 60.0;
+    static constexpr size_t writeBufferSize = 1 << 18;
+
+    static auto findRegions(const std::vector<float>& conf, double sampleRate, const Options& options) -> std::vector<ChopRegion>;
+    static auto meanRms(const float* samples, int numSamples) -> double;
+    static auto trim(const float* samples, int numSamples) -> Range<int>;
+
+    static auto getOutputFolder(const File& destFolder, const String& name, int index = 1) -> File;
+    static auto selectChop(const float* samples, int numSamples, double sampleRate, const Options& options) -> std::optional<Range<int>>;
+    static auto selectChops(PositionableAudioSource& source, int numChannels, double sourceRate, double analysisRate,
+        const std::vector<ChopRegion>& regions, const Options& options) -> std::vector<ChopRegion>;
+
+    static auto writeChop(const File& file, const float* samples, int numSamples, double sampleRate) -> bool;
+    static auto writeChop(const File& file, const AudioBuffer<float>& audio, double sampleRate, int bitsPerSample) -> bool;
+    static auto exportChop(const float* samples, int numSamples, double sampleRate, const File& outputFolder, 
+        int index, const Options& options) -> bool;
+    static auto exportSourceChops(const File& source, double analysisRate, const std::vector<ChopRegion>& chops,
+        const File& outputFolder, int numThreads = 0) -> int;
+    static auto exportBufferChops(const AudioBuffer<float>& source, double sampleRate, double analysisRate,
+        const std::vector<ChopRegion>& chops, const File& outputFolder, int numThreads = 0) -> int;
+
+private:
+    static auto framePowers(const float* samples, int numSamples) -> std::vector<double>;
+};
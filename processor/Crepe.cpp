@@ -0,0 +1,468 @@
+#include "Crepe.h"
+#include <bit>
+#include <thread>
+
+namespace {
+    constexpr int tileRows = 4;
+    constexpr int tileCols = 8;
+    constexpr int maxLayers = 16;
+    constexpr int maxFilters = 4096;
+
+    auto halfToFloat(uint16 half) -> float {
+        auto sign = static_cast<uint32>(half & 0x8000u) << 16;
+        auto exponent = static_cast<uint32>((half >> 10) & 0x1fu);
+        auto mantissa = static_cast<uint32>(half & 0x3ffu);
+
+        if (exponent == 0) {
+            if (mantissa == 0) return std::bit_cast<float>(sign);
+            exponent = 113;
+            while ((mantissa & 0x400u) == 0) {
+                mantissa <<= 1;
+                exponent--;
+            }
+            return std::bit_cast<float>(sign | (exponent << 23) | ((mantissa & 0x3ffu) << 13));
+        }
+        if (exponent == 31) return std::bit_cast<float>(sign | 0x7f800000u | (mantissa << 13));
+        return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+    }
+
+    auto readHalfs(InputStream& stream, size_t count) -> std::vector<float> {
+        if (count == 0 || static_cast<int64>(count * sizeof(uint16)) > stream.getNumBytesRemaining()) return {};
+        std::vector<uint16> raw(count);
+        auto bytes = static_cast<int>(count * sizeof(uint16));
+        if (stream.read(raw.data(), bytes) != bytes) return {};
+
+        std::vector<float> result(count);
+        for (size_t i = 0; i < count; i++) result[i] = halfToFloat(raw[i]);
+        return result;
+    }
+
+    auto readFloats(InputStream& stream, size_t count) -> std::vector<float> {
+        if (count == 0 || static_cast<int64>(count * sizeof(float)) > stream.getNumBytesRemaining()) return {};
+        std::vector<float> result(count);
+        auto bytes = static_cast<int>(count * sizeof(float));
+        if (stream.read(result.data(), bytes) != bytes) return {};
+        return result;
+    }
+
+    auto roundUp(int value, int multiple) -> int {
+        return (value + multiple - 1) / multiple * multiple;
+    }
+}
+
+auto PitchFrames::save(const File& file) const -> bool {
+    file.deleteFile();
+    FileOutputStream stream{file};
+    if (!stream.openedOk()) return false;
+
+    auto bytes = static_cast<size_t>(this->size()) * sizeof(float);
+    stream.write("VCPF", 4);
+    stream.writeInt(1);
+    stream.writeInt(this->size());
+    stream.write(this->time.data(), bytes);
+    stream.write(this->freq.data(), bytes);
+    stream.write(this->conf.data(), bytes);
+    stream.flush();
+    return stream.getStatus().wasOk();
+}
+
+auto PitchFrames::load(const File& file) -> std::optional<PitchFrames> {
+    FileInputStream stream{file};
+    if (!stream.openedOk()) return std::nullopt;
+
+    char magic[4] = {};
+    if (stream.read(magic, 4) != 4 || std::memcmp(magic, "VCPF", 4) != 0) return std::nullopt;
+    if (stream.readInt() != 1) return std::nullopt;
+
+    auto count = stream.readInt();
+    if (count < 0 || stream.getTotalLength() != 12 + static_cast<int64>(count) * 3 * 4) return std::nullopt;
+
+    PitchFrames frames;
+    frames.time = readFloats(stream, static_cast<size_t>(count));
+    frames.freq = readFloats(stream, static_cast<size_t>(count));
+    frames.conf = readFloats(stream, static_cast<size_t>(count));
+    if (frames.conf.size() != static_cast<size_t>(count)) return std::nullopt;
+    return frames;
+}
+
+auto Crepe::getModelFile() -> File {
+    return File::getSpecialLocation(File::userApplicationDataDirectory)
+        .getChildFile(JucePlugin_Manufacturer)
+        .getChildFile(JucePlugin_Name)
+        .getChildFile("models")
+        .getChildFile("crepe-full.bin");
+}
+
+auto Crepe::getShared() -> std::shared_ptr<Crepe> {
+    static CriticalSection lock;
+    static std::shared_ptr<Crepe> shared;
+
+    const ScopedLock sl{lock};
+    if (shared == nullptr) shared = Crepe::load(Crepe::getModelFile());
+    return shared;
+}
+
+auto Crepe::load(const File& modelFile) -> std::unique_ptr<Crepe> {
+    FileInputStream stream{modelFile};
+    if (!stream.openedOk()) return nullptr;
+
+    char magic[4] = {};
+    if (stream.read(magic, 4) != 4 || std::memcmp(magic, "CREP", 4) != 0) return nullptr;
+    // Version 1 stores kernels as fp16, version 2 as fp32 for exports that fp16 cannot keep within tolerance.
+    auto version = stream.readInt();
+    if (version != 1 && version != 2) return nullptr;
+    auto readWeights = [&](size_t count) { return version == 1 ? readHalfs(stream, count) : readFloats(stream, count); };
+
+    auto model = std::make_unique<Crepe>();
+    auto numLayers = stream.readInt();
+    if (numLayers <= 0 || numLayers > maxLayers) return nullptr;
+    int channels = 1;
+    int length = frameSize;
+
+    for (int l = 0; l < numLayers; l++) {
+        Layer layer;
+        layer.filters = stream.readInt();
+        layer.channels = stream.readInt();
+        layer.width = stream.readInt();
+        layer.stride = stream.readInt();
+        if (layer.filters <= 0 || layer.filters > maxFilters || layer.filters % tileRows != 0 || layer.channels != channels) return nullptr;
+        if (layer.width <= 0 || layer.stride <= 0) return nullptr;
+        length = (length + layer.stride - 1) / layer.stride / 2;
+        if (length <= 0) return nullptr;
+
+        auto depth = static_cast<size_t>(layer.channels) * static_cast<size_t>(layer.width);
+        auto raw = readWeights(static_cast<size_t>(layer.filters) * depth);
+        if (raw.empty()) return nullptr;
+
+        layer.weights.resize(raw.size());
+        for (int o = 0; o < layer.filters; o++) {
+            auto block = static_cast<size_t>(o / tileRows) * depth * tileRows;
+            for (size_t k = 0; k < depth; k++) {
+                layer.weights[block + k * tileRows + static_cast<size_t>(o % tileRows)] = raw[static_cast<size_t>(o) * depth + k];
+            }
+        }
+        layer.bias = readFloats(stream, static_cast<size_t>(layer.filters));
+        layer.scale = readFloats(stream, static_cast<size_t>(layer.filters));
+        layer.shift = readFloats(stream, static_cast<size_t>(layer.filters));
+        if (layer.shift.empty()) return nullptr;
+
+        channels = layer.filters;
+        model->layers.push_back(std::move(layer));
+    }
+
+    auto outputs = stream.readInt();
+    model->denseInputs = stream.readInt();
+    if (outputs != numBins || model->denseInputs != length * channels) return nullptr;
+
+    model->denseWeights = readWeights(static_cast<size_t>(outputs) * static_cast<size_t>(model->denseInputs));
+    model->denseBias = readFloats(stream, static_cast<size_t>(outputs));
+    if (model->denseWeights.empty() || model->denseBias.empty()) return nullptr;
+    return model;
+}
+
+auto Crepe::convolve(const Layer& layer, const float* input, int inputLength, Scratch& scratch) const -> int {
+    auto outLength = (inputLength + layer.stride - 1) / layer.stride;
+    auto padTotal = jmax((outLength - 1) * layer.stride + layer.width - inputLength, 0);
+    auto padBefore = padTotal / 2;
+    auto paddedLength = inputLength + padTotal;
+    auto depth = layer.channels * layer.width;
+
+    auto& padded = scratch.input;
+    padded.assign(static_cast<size_t>(layer.channels * paddedLength + tileCols), 0.0f);
+    for (int c = 0; c < layer.channels; c++) {
+        std::copy_n(input + c * inputLength, inputLength, padded.data() + c * paddedLength + padBefore);
+    }
+
+    scratch.output.resize(static_cast<size_t>(layer.filters * outLength));
+    auto* output = scratch.output.data();
+
+    scratch.rows.resize(static_cast<size_t>(depth));
+    if (layer.stride == 1) {
+        for (int c = 0; c < layer.channels; c++) {
+            for (int k = 0; k < layer.width; k++) {
+                scratch.rows[static_cast<size_t>(c * layer.width + k)] = padded.data() + c * paddedLength + k;
+            }
+        }
+    } else {
+        auto columnStride = roundUp(outLength, tileCols);
+        scratch.columns.assign(static_cast<size_t>(depth * columnStride), 0.0f);
+        for (int c = 0; c < layer.channels; c++) {
+            for (int k = 0; k < layer.width; k++) {
+                auto row = c * layer.width + k;
+                auto* column = scratch.columns.data() + row * columnStride;
+                auto* source = padded.data() + c * paddedLength + k;
+                for (int t = 0; t < outLength; t++) column[t] = source[t * layer.stride];
+                scratch.rows[static_cast<size_t>(row)] = column;
+            }
+        }
+    }
+
+    for (int block = 0; block < layer.filters / tileRows; block++) {
+        auto* weights = layer.weights.data() + static_cast<size_t>(block) * static_cast<size_t>(depth) * tileRows;
+
+        for (int n = 0; n < outLength; n += tileCols) {
+            float acc[tileRows][tileCols] = {};
+
+            for (int k = 0; k < depth; k++) {
+                auto* b = scratch.rows[static_cast<size_t>(k)] + n;
+                auto* a = weights + k * tileRows;
+                for (int m = 0; m < tileRows; m++) {
+                    for (int j = 0; j < tileCols; j++) acc[m][j] += a[m] * b[j];
+                }
+            }
+
+            auto cols = jmin(tileCols, outLength - n);
+            for (int m = 0; m < tileRows; m++) {
+                auto o = block * tileRows + m;
+                auto* dest = output + o * outLength + n;
+                for (int j = 0; j < cols; j++) {
+                    dest[j] = jmax(acc[m][j] + layer.bias[static_cast<size_t>(o)], 0.0f) * layer.scale[static_cast<size_t>(o)]
+                        + layer.shift[static_cast<size_t>(o)];
+                }
+            }
+        }
+    }
+
+    auto pooledLength = outLength / 2;
+    for (int o = 0; o < layer.filters; o++) {
+        auto* source = output + o * outLength;
+        auto* dest = output + o * pooledLength;
+        for (int t = 0; t < pooledLength; t++) dest[t] = jmax(source[2 * t], source[2 * t + 1]);
+    }
+    return pooledLength;
+}
+
+auto Crepe::activate(const float* frame, float* activation, Scratch& scratch) const -> void {
+    auto* current = frame;
+    int length = frameSize;
+
+    for (auto& layer : this->layers) {
+        length = this->convolve(layer, current, length, scratch);
+        current = scratch.output.data();
+    }
+
+    auto channels = this->layers.back().filters;
+    auto& flat = scratch.columns;
+    flat.resize(static_cast<size_t>(this->denseInputs));
+    for (int t = 0; t < length; t++) {
+        for (int c = 0; c < channels; c++) flat[static_cast<size_t>(t * channels + c)] = current[c * length + t];
+    }
+
+    for (int j = 0; j < numBins; j++) {
+        auto* weights = this->denseWeights.data() + static_cast<size_t>(j) * static_cast<size_t>(this->denseInputs);
+        float partial[tileCols] = {};
+        int i = 0;
+        for (; i + tileCols <= this->denseInputs; i += tileCols) {
+            for (int p = 0; p < tileCols; p++) partial[p] += weights[i + p] * flat[static_cast<size_t>(i + p)];
+        }
+        auto sum = this->denseBias[static_cast<size_t>(j)];
+        for (; i < this->denseInputs; i++) sum += weights[i] * flat[static_cast<size_t>(i)];
+        for (auto value : partial) sum += value;
+        activation[j] = 1.0f / (1.0f + std::exp(-sum));
+    }
+}
+
+auto Crepe::decodeViterbi(const std::vector<float>& activations, int numFrames) -> std::vector<int> {
+    constexpr int maxJump = 11;
+    constexpr double selfEmission = 0.1;
+    auto matchEmission = std::log(selfEmission + (1.0 - selfEmission) / numBins);
+    auto otherEmission = std::log((1.0 - selfEmission) / numBins);
+
+    std::vector<double> transitions(static_cast<size_t>(numBins) * (2 * maxJump + 1));
+    for (int i = 0; i < numBins; i++) {
+        double rowSum = 0.0;
+        for (int j = jmax(0, i - maxJump); j <= jmin(numBins - 1, i + maxJump); j++) rowSum += 12 - std::abs(i - j);
+        for (int offset = -maxJump; offset <= maxJump; offset++) {
+            transitions[static_cast<size_t>(i * (2 * maxJump + 1) + offset + maxJump)] = std::log((12 - std::abs(offset)) / rowSum);
+        }
+    }
+
+    std::vector<int> path(static_cast<size_t>(numFrames));
+    if (numFrames == 0) return path;
+
+    for (int f = 0; f < numFrames; f++) {
+        auto* salience = activations.data() + static_cast<size_t>(f) * numBins;
+        path[static_cast<size_t>(f)] = static_cast<int>(std::max_element(salience, salience + numBins) - salience);
+    }
+
+    std::vector<int8> backtrack(static_cast<size_t>(numFrames) * numBins);
+    std::array<double, numBins> delta = {};
+    std::array<double, numBins> next = {};
+
+    for (int s = 0; s < numBins; s++) {
+        delta[static_cast<size_t>(s)] = std::log(1.0 / numBins) + (s == path[0] ? matchEmission : otherEmission);
+    }
+
+    for (int f = 1; f < numFrames; f++) {
+        auto observation = path[static_cast<size_t>(f)];
+        for (int j = 0; j < numBins; j++) {
+            auto best = -std::numeric_limits<double>::infinity();
+            int bestOffset = 0;
+            for (int i = jmax(0, j - maxJump); i <= jmin(numBins - 1, j + maxJump); i++) {
+                auto score = delta[static_cast<size_t>(i)] + transitions[static_cast<size_t>(i * (2 * maxJump + 1) + j - i + maxJump)];
+                if (score > best) {
+                    best = score;
+                    bestOffset = i - j;
+                }
+            }
+            next[static_cast<size_t>(j)] = best + (j == observation ? matchEmission : otherEmission);
+            backtrack[static_cast<size_t>(f) * numBins + static_cast<size_t>(j)] = static_cast<int8>(bestOffset);
+        }
+        delta = next;
+    }
+
+    auto state = static_cast<int>(std::max_element(delta.begin(), delta.end()) - delta.begin());
+    for (int f = numFrames - 1; f >= 0; f--) {
+        path[static_cast<size_t>(f)] = state;
+        state += backtrack[static_cast<size_t>(f) * numBins + static_cast<size_t>(state)];
+    }
+    return path;
+}
+
+auto Crepe::normalize(float* frame) -> void {
+    double sum = 0.0;
+    for (int i = 0; i < frameSize; i++) sum += frame[i];
+    auto mean = sum / frameSize;
+    double variance = 0.0;
+    for (int i = 0; i < frameSize; i++) variance += (frame[i] - mean) * (frame[i] - mean);
+    auto deviation = jmax(std::sqrt(variance / frameSize), 1e-8);
+    for (int i = 0; i < frameSize; i++) frame[i] = static_cast<float>((frame[i] - mean) / deviation);
+}
+
+auto Crepe::confidence(const float* samples, Context& context) const -> float {
+    std::copy(samples, samples + frameSize, context.frame.begin());
+    normalize(context.frame.data());
+    this->activate(context.frame.data(), context.activation.data(), context.scratch);
+    return *std::max_element(context.activation.begin(), context.activation.end());
+}
+
+auto Crepe::ConfidenceStream::push(const float* samples, int numSamples) -> void {
+    this->window.insert(this->window.end(), samples, samples + numSamples);
+    this->received += numSamples;
+
+    auto complete = this->received < frameSize / 2 ? 0 : 1 + static_cast<int>((this->received - frameSize / 2) / hopSize);
+    this->process(complete - static_cast<int>(this->conf.size()));
+}
+
+auto Crepe::ConfidenceStream::finish() -> PitchFrames {
+    auto numFrames = 1 + static_cast<int>(this->received / hopSize);
+    auto last = static_cast<int64>(numFrames - 1) * hopSize + frameSize / 2;
+    this->window.resize(static_cast<size_t>(jmax<int64>(static_cast<int64>(this->window.size()), last - this->windowStart)), 0.0f);
+    this->process(numFrames - static_cast<int>(this->conf.size()));
+
+    PitchFrames frames;
+    frames.conf = std::move(this->conf);
+    frames.freq.assign(frames.conf.size(), 0.0f);
+    frames.time.resize(frames.conf.size());
+    for (size_t f = 0; f < frames.time.size(); f++) frames.time[f] = static_cast<float>(f * hopSize) / sampleRate;
+    return frames;
+}
+
+auto Crepe::ConfidenceStream::process(int numFrames) -> void {
+    if (numFrames <= 0) return;
+    auto first = static_cast<int>(this->conf.size());
+    this->conf.resize(this->conf.size() + static_cast<size_t>(numFrames));
+
+    auto numThreads = jlimit(1, SystemStats::getNumCpus(), numFrames / 8);
+    if (static_cast<int>(this->contexts.size()) < numThreads) this->contexts.resize(static_cast<size_t>(numThreads));
+
+    std::atomic<int> next = 0;
+    auto worker = [&](Context& context) {
+        for (auto f = next++; f < numFrames; f = next++) {
+            auto start = static_cast<int64>(first + f) * hopSize - frameSize / 2 - this->windowStart;
+            this->conf[static_cast<size_t>(first + f)] = this->model.confidence(this->window.data() + start, context);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int i = 1; i < numThreads; i++) threads.emplace_back(worker, std::ref(this->contexts[static_cast<size_t>(i)]));
+    worker(this->contexts.front());
+    for (auto& thread : threads) thread.join();
+
+    auto keep = static_cast<int64>(this->conf.size()) * hopSize - frameSize / 2;
+    auto drop = static_cast<size_t>(jlimit<int64>(0, static_cast<int64>(this->window.size()), keep - this->windowStart));
+    this->window.erase(this->window.begin(), this->window.begin() + static_cast<std::ptrdiff_t>(drop));
+    this->windowStart += static_cast<int64>(drop);
+}
+
+auto Crepe::localAverageCents(const float* salience, int center) -> float {
+    static const auto centsMapping = [] {
+        std::array<double, numBins> mapping = {};
+        for (int i = 0; i < numBins; i++) mapping[static_cast<size_t>(i)] = 7180.0 * i / (numBins - 1) + 1997.3794084376191;
+        return mapping;
+    }();
+
+    double product = 0.0;
+    double weight = 0.0;
+    for (int i = jmax(0, center - 4); i < jmin(numBins, center + 5); i++) {
+        product += salience[i] * centsMapping[static_cast<size_t>(i)];
+        weight += salience[i];
+    }
+    return weight > 0.0 ? static_cast<float>(product / weight) : std::numeric_limits<float>::quiet_NaN();
+}
+
+auto Crepe::predict(const float* audio, int numSamples, bool viterbi,
+    const std::function<void(int, int)>& onProgress, const std::function<bool()>& shouldExit) const -> PitchFrames {
+    constexpr int batchSize = 32;
+    auto numFrames = 1 + numSamples / hopSize;
+    auto numBatches = (numFrames + batchSize - 1) / batchSize;
+    std::vector<float> activations(static_cast<size_t>(numFrames) * numBins);
+
+    std::atomic<int> nextBatch = 0;
+    std::atomic<int> framesDone = 0;
+
+    auto worker = [&](bool reportProgress) {
+        Scratch scratch;
+        std::array<float, frameSize> frame = {};
+
+        for (auto batch = nextBatch++; batch < numBatches; batch = nextBatch++) {
+            auto start = batch * batchSize;
+            auto end = jmin(start + batchSize, numFrames);
+
+            for (int f = start; f < end; f++) {
+                for (int i = 0; i < frameSize; i++) {
+                    auto index = f * hopSize - frameSize / 2 + i;
+                    frame[static_cast<size_t>(i)] = index >= 0 && index < numSamples ? audio[index] : 0.0f;
+                }
+                normalize(frame.data());
+
+                this->activate(frame.data(), activations.data() + static_cast<size_t>(f) * numBins, scratch);
+            }
+            auto done = framesDone += end - start;
+            if (reportProgress && onProgress) onProgress(done, numFrames);
+            if (reportProgress && shouldExit && shouldExit()) nextBatch = numBatches;
+        }
+    };
+
+    auto numThreads = jlimit(1, jmax(numBatches, 1), SystemStats::getNumCpus());
+    std::vector<std::thread> threads;
+    for (int i = 1; i < numThreads; i++) threads.emplace_back(worker, false);
+    worker(true);
+    for (auto& thread : threads) thread.join();
+    if (onProgress) onProgress(numFrames, numFrames);
+
+    std::vector<int> path(static_cast<size_t>(numFrames));
+    if (viterbi) {
+        path = decodeViterbi(activations, numFrames);
+    } else {
+        for (int f = 0; f < numFrames; f++) {
+            auto* salience = activations.data() + static_cast<size_t>(f) * numBins;
+            path[static_cast<size_t>(f)] = static_cast<int>(std::max_element(salience, salience + numBins) - salience);
+        }
+    }
+
+    PitchFrames frames;
+    frames.time.resize(static_cast<size_t>(numFrames));
+    frames.freq.resize(static_cast<size_t>(numFrames));
+    frames.conf.resize(static_cast<size_t>(numFrames));
+
+    for (int f = 0; f < numFrames; f++) {
+        auto* salience = activations.data() + static_cast<size_t>(f) * numBins;
+        auto cents = localAverageCents(salience, path[static_cast<size_t>(f)]);
+        auto freq = 10.0f * std::pow(2.0f, cents / 1200.0f);
+
+        frames.time[static_cast<size_t>(f)] = static_cast<float>(f * hopSize) / sampleRate;
+        frames.freq[static_cast<size_t>(f)] = std::isfinite(freq) ? freq : 0.0f;
+        frames.conf[static_cast<size_t>(f)] = *std::max_element(salience, salience + numBins);
+    }
+    return frames;
+}
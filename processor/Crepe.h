@@ -0,0 +1,88 @@
+#pragma once
+#include <JuceHeader.h>
+
+struct PitchFrames {
+    std::vector<float> time;
+    std::vector<float> freq;
+    std::vector<float> conf;
+
+    auto size() const -> int { return static_cast<int>(this->conf.size()); }
+    auto save(const File& file) const -> bool;
+    static auto load(const File& file) -> std::optional<PitchFrames>;
+};
+
+class Crepe {
+public:
+    static constexpr int sampleRate = 16000;
+    static constexpr int frameSize = 1024;
+    static constexpr int hopSize = 160;
+    static constexpr int numBins = 360;
+
+    static auto getModelFile() -> File;
+    static auto getShared() -> std::shared_ptr<Crepe>;
+    static auto load(const File& modelFile) -> std::unique_ptr<Crepe>;
+
+    auto predict(const float* audio, int numSamples, bool viterbi = true,
+        const std::function<void(int, int)>& onProgress = nullptr,
+        const std::function<bool()>& shouldExit = nullptr) const -> PitchFrames;
+
+private:
+    struct Layer {
+        int filters = 0;
+        int channels = 0;
+        int width = 0;
+        int stride = 1;
+        std::vector<float> weights;
+        std::vector<float> bias;
+        std::vector<float> scale;
+        std::vector<float> shift;
+    };
+
+    struct Scratch {
+        std::vector<float> input;
+        std::vector<float> output;
+        std::vector<float> columns;
+        std::vector<const float*> rows;
+    };
+
+    auto activate(const float* frame, float* activation, Scratch& scratch) const -> void;
+    auto convolve(const Layer& layer, const float* input, int inputLength, Scratch& scratch) const -> int;
+    static auto decodeViterbi(const std::vector<float>& activations, int numFrames) -> std::vector<int>;
+    static auto localAverageCents(const float* salience, int center) -> float;
+    static auto normalize(float* frame) -> void;
+
+    std::vector<Layer> layers;
+    std::vector<float> denseWeights;
+    std::vector<float> denseBias;
+    int denseInputs = 0;
+
+public:
+    class Context {
+        friend class Crepe;
+        Scratch scratch;
+        std::array<float, frameSize> frame = {};
+        std::array<float, numBins> activation = {};
+    };
+
+    auto confidence(const float* samples, Context& context) const -> float;
+
+    // Per-frame confidence over audio pushed in blocks, only a frame's worth of samples is kept between pushes.
+    class ConfidenceStream {
+    public:
+        explicit ConfidenceStream(const Crepe& model) : model(model) {}
+
+        auto push(const float* samples, int numSamples) -> void;
+        // Time and confidence of every frame, freq stays zero since chopping only reads confidence.
+        auto finish() -> PitchFrames;
+
+    private:
+        auto process(int numFrames) -> void;
+
+        const Crepe& model;
+        std::vector<float> window = std::vector<float>(frameSize / 2, 0.0f);
+        int64 windowStart = -frameSize / 2;
+        int64 received = 0;
+        std::vector<float> conf;
+        std::vector<Context> contexts;
+    };
+};
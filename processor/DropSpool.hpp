@@ -0,0 +1,89 @@
+#pragma once
+#include <JuceHeader.h>
+#include "ContentHash.hpp"
+#include "DropStore.hpp"
+
+class DropSpool {
+public:
+    ~DropSpool() { this->cancel(); }
+
+    auto begin(const String& name, int64 size) -> bool {
+        this->cancel();
+        auto folder = DropStore::getStoreFolder();
+        folder.createDirectory();
+
+        this->name = File::createLegalFileName(name);
+        this->partFile = folder.getChildFile(Uuid().toString() + ".part");
+        this->stream = this->partFile.createOutputStream();
+        this->hash = ContentHash{};
+        this->expectedSize = size;
+        this->written = 0;
+
+        if (this->stream == nullptr || !this->stream->openedOk()) {
+            this->cancel();
+            return false;
+        }
+        return true;
+    }
+
+    auto append(const String& base64) -> bool {
+        if (this->stream == nullptr) return false;
+        MemoryOutputStream chunkStream{this->chunk, false};
+
+        if (!Base64::convertFromBase64(chunkStream, base64)) return false;
+        auto size = static_cast<int64>(chunkStream.getDataSize());
+        if (this->written + size > this->expectedSize) return false;
+
+        return this->write(chunkStream.getData(), chunkStream.getDataSize());
+    }
+
+    auto write(const void* data, size_t size) -> bool {
+        if (this->stream == nullptr) return false;
+        this->hash.update(data, size);
+        if (!this->stream->write(data, size)) return false;
+        this->written += static_cast<int64>(size);
+        return true;
+    }
+
+    auto finish() -> File {
+        if (this->stream == nullptr) return {};
+        this->stream->flush();
+        this->stream.reset();
+
+        if (this->written != this->expectedSize) {
+            this->cancel();
+            return {};
+        }
+        auto target = DropStore::getFile(this->getHash(), this->name);
+        target.getParentDirectory().createDirectory();
+
+        if (target.existsAsFile() && target.getSize() == this->written) {
+            this->partFile.deleteFile();
+        } else if (!this->partFile.moveFileTo(target)) {
+            this->cancel();
+            return {};
+        }
+        this->partFile = File{};
+        DropStore::touch(target);
+        DropStore::evict(DropStore::getMaxBytes(), target);
+        return target;
+    }
+
+    auto cancel() -> void {
+        this->stream.reset();
+        if (this->partFile != File{}) this->partFile.deleteFile();
+        this->partFile = File{};
+    }
+
+    auto getHash() const -> String { return this->hash.toString(); }
+    auto getBytesWritten() const -> int64 { return this->written; }
+
+private:
+    String name = "";
+    File partFile;
+    std::unique_ptr<FileOutputStream> stream;
+    MemoryBlock chunk;
+    ContentHash hash;
+    int64 expectedSize = 0;
+    int64 written = 0;
+};
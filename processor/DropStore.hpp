@@ -0,0 +1,97 @@
+#pragma once
+#include <JuceHeader.h>
+#include "Settings.hpp"
+
+class DropStore {
+public:
+    static constexpr int staleSpoolHours = 24;
+
+    static auto getStoreFolder() -> File {
+        return File::getSpecialLocation(File::userApplicationDataDirectory)
+            .getChildFile(JucePlugin_Manufacturer)
+            .getChildFile(JucePlugin_Name)
+            .getChildFile("dropped");
+    }
+
+    static auto getMaxBytes() -> int64 {
+        auto megabytes = Settings::getInt64("dropStoreMegabytes", 2048);
+        return jmax<int64>(0, megabytes) * 1024 * 1024;
+    }
+
+    static auto getFile(const String& hash, const String& name) -> File {
+        if (hash.isEmpty() || name.isEmpty()) return {};
+        return getStoreFolder().getChildFile(hash).getChildFile(File::createLegalFileName(name));
+    }
+
+    static auto find(const String& hash, const String& name) -> File {
+        auto file = getFile(hash, name);
+        if (!file.existsAsFile()) return {};
+        touch(file);
+        return file;
+    }
+
+    static auto getHash(const File& file) -> String {
+        return file.isAChildOf(getStoreFolder()) ? file.getParentDirectory().getFileName() : String{};
+    }
+
+    static auto pin(const String& hash) -> void {
+        const ScopedLock sl{getLock()};
+        if (hash.isNotEmpty()) getPins()[hash]++;
+    }
+
+    static auto unpin(const String& hash) -> void {
+        const ScopedLock sl{getLock()};
+        auto& pins = getPins();
+        if (auto it = pins.find(hash); it != pins.end() && --it->second <= 0) pins.erase(it);
+    }
+
+    static auto touch(const File& file) -> void {
+        if (file.existsAsFile() && file.isAChildOf(getStoreFolder())) file.setLastModificationTime(Time::getCurrentTime());
+    }
+
+    static auto evict(int64 maxBytes, const File& keep = {}) -> void {
+        const ScopedLock sl{getLock()};
+        struct Entry { File folder; Time lastUsed; int64 size; };
+        std::vector<Entry> entries;
+        int64 total = 0;
+        auto staleTime = Time::getCurrentTime() - RelativeTime::hours(staleSpoolHours);
+
+        for (auto& part : getStoreFolder().findChildFiles(File::findFiles, false, "*.part")) {
+            if (part.getLastModificationTime() < staleTime) part.deleteFile();
+        }
+
+        for (auto& folder : getStoreFolder().findChildFiles(File::findDirectories, false)) {
+            Entry entry{folder, {}, 0};
+            for (auto& file : folder.findChildFiles(File::findFiles, false)) {
+                entry.lastUsed = jmax(entry.lastUsed, file.getLastModificationTime());
+                entry.size += file.getSize();
+            }
+            if (entry.size == 0) {
+                folder.deleteRecursively();
+                continue;
+            }
+            total += entry.size;
+            if (keep.isAChildOf(folder) || getPins().count(folder.getFileName()) > 0) continue;
+            entries.push_back(entry);
+        }
+
+        std::sort(entries.begin(), entries.end(), [](auto& a, auto& b) { return a.lastUsed < b.lastUsed; });
+        for (auto& entry : entries) {
+            if (total <= maxBytes) break;
+            entry.folder.deleteRecursively();
+            total -= entry.size;
+        }
+    }
+
+private:
+    static auto getLock() -> CriticalSection& {
+        static CriticalSection lock;
+        return lock;
+    }
+
+    // Hashes referenced by a loaded session or the current selection, never evicted.
+    static auto getPins() -> std::map<String, int>& {
+        static std::map<String, int> pins;
+        return pins;
+    }
+};
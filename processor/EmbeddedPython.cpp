@@ -0,0 +1,273 @@
+#if VOCAL_CHOPPER_EMBED_PYTHON
+  #define PY_SSIZE_T_CLEAN
+  #include <Python.h>
+#endif
+
+#include "EmbeddedPython.h"
+
+#if VOCAL_CHOPPER_EMBED_PYTHON
+#include "Settings.hpp"
+#include "Provisioner.hpp"
+
+struct ProgressBridge {
+    const std::function<void(const PythonWorker::Progress&)>& onProgress;
+    const std::function<bool()>& shouldExit;
+};
+
+static auto reportProgress(PyObject* self, PyObject* arg) -> PyObject* {
+    auto* bridge = static_cast<ProgressBridge*>(PyCapsule_GetPointer(self, "progress"));
+    const auto* text = PyUnicode_AsUTF8(arg);
+    if (bridge == nullptr || text == nullptr) return nullptr;
+
+    if (bridge->shouldExit()) {
+        PyErr_SetString(PyExc_KeyboardInterrupt, "cancelled");
+        return nullptr;
+    }
+    bridge->onProgress(PythonWorker::Progress::fromVar(JSON::parse(String::fromUTF8(text))));
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef progressMethod{"progress", reportProgress, METH_O, nullptr};
+
+static auto createProgressCallback(ProgressBridge& bridge) -> PyObject* {
+    auto* capsule = PyCapsule_New(&bridge, "progress", nullptr);
+    if (capsule == nullptr) return nullptr;
+    auto* callback = PyCFunction_New(&progressMethod, capsule);
+    Py_DECREF(capsule);
+    return callback;
+}
+
+static auto takeError() -> String {
+    PyObject* type = nullptr;
+    PyObject* value = nullptr;
+    PyObject* traceback = nullptr;
+    PyErr_Fetch(&type, &value, &traceback);
+    PyErr_NormalizeException(&type, &value, &traceback);
+
+    String message = type != nullptr ? String{reinterpret_cast<PyTypeObject*>(type)->tp_name} : String{"unknown error"};
+    if (auto* text = value != nullptr ? PyObject_Str(value) : nullptr) {
+        if (const auto* utf8 = PyUnicode_AsUTF8(text)) message << ": " << String::fromUTF8(utf8);
+        Py_DECREF(text);
+    }
+    Py_XDECREF(type);
+    Py_XDECREF(value);
+    Py_XDECREF(traceback);
+    PyErr_Clear();
+    return message;
+}
+
+// Runs the interpreter the provisioner installed into, rather than whatever Python the host process would find.
+static auto configureInterpreter(String& error) -> bool {
+    auto marker = JSON::parse(Provisioner::getMarkerFile());
+    auto home = marker["home"].toString();
+    auto* paths = marker["paths"].getArray();
+    if (home.isEmpty() || paths == nullptr) {
+        error = "python setup has not recorded an interpreter in " + Provisioner::getMarkerFile().getFullPathName();
+        return false;
+    }
+    auto linked = String{PY_MAJOR_VERSION} + "." + String{PY_MINOR_VERSION};
+    if (marker["python_version"].toString() != linked) {
+        error = "the provisioned python is " + marker["python_version"].toString() + " but the plugin links python " + linked;
+        return false;
+    }
+
+    PyConfig config;
+    PyConfig_InitPythonConfig(&config);
+    config.install_signal_handlers = 0;
+    config.parse_argv = 0;
+    config.module_search_paths_set = 1;
+    auto status = PyConfig_SetString(&config, &config.home, home.toWideCharPointer());
+    if (!PyStatus_Exception(status) && marker["executable"].toString().isNotEmpty()) {
+        status = PyConfig_SetString(&config, &config.executable, marker["executable"].toString().toWideCharPointer());
+    }
+    for (auto& path : *paths) {
+        if (PyStatus_Exception(status)) break;
+        status = PyWideStringList_Append(&config.module_search_paths, path.toString().toWideCharPointer());
+    }
+    if (!PyStatus_Exception(status)) status = Py_InitializeFromConfig(&config);
+    PyConfig_Clear(&config);
+
+    if (PyStatus_Exception(status)) {
+        error = "python failed to start: " + String{status.err_msg != nullptr ? status.err_msg : "unknown error"};
+        return false;
+    }
+    PyEval_SaveThread();
+    return true;
+}
+
+static auto initialiseInterpreter(String& error) -> bool {
+    static std::once_flag once;
+    static bool initialised = false;
+    static String failure;
+    std::call_once(once, []() {
+        // Never finalised, numpy and torch cannot be imported again after Py_Finalize.
+        initialised = Py_IsInitialized() != 0 || configureInterpreter(failure);
+    });
+    error = failure;
+    return initialised;
+}
+
+EmbeddedPython::EmbeddedPython() : Thread("Embedded Python") {
+    this->startThread();
+}
+
+EmbeddedPython::~EmbeddedPython() {
+    this->signalThreadShouldExit();
+    this->wakeUp.signal();
+    this->stopThread(-1);
+}
+
+auto EmbeddedPython::isEnabled() -> bool {
+    return Settings::getInt("embeddedPython", 1) != 0;
+}
+
+auto EmbeddedPython::run() -> void {
+    if (initialiseInterpreter(this->loadError)) {
+        auto state = PyGILState_Ensure();
+        this->ready = this->loadModule();
+        PyGILState_Release(state);
+    }
+    this->loaded.signal();
+
+    while (!this->threadShouldExit()) {
+        this->wakeUp.wait(100);
+        std::deque<std::function<void()>> pending;
+        {
+            const ScopedLock sl{this->lock};
+            std::swap(pending, this->tasks);
+        }
+        if (pending.empty()) continue;
+
+        auto state = PyGILState_Ensure();
+        for (auto& task : pending) task();
+        PyGILState_Release(state);
+    }
+}
+
+auto EmbeddedPython::loadModule() -> bool {
+    auto* module = PyImport_AddModule("chopper");
+    if (module == nullptr) {
+        this->loadError = "could not create the chopper module: " + takeError();
+        return false;
+    }
+    if (PyObject_HasAttrString(module, "run_embedded")) return true;
+
+    auto* globals = PyModule_GetDict(module);
+    PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+    auto source = String::fromUTF8(BinaryData::chopper_py, BinaryData::chopper_pySize);
+    auto* result = PyRun_String(source.toRawUTF8(), Py_file_input, globals, globals);
+    if (result == nullptr) {
+        this->loadError = "chopper.py failed to load: " + takeError();
+        return false;
+    }
+    Py_DECREF(result);
+    return true;
+}
+
+auto EmbeddedPython::getLoadError() -> String {
+    this->loaded.wait();
+    return this->loadError;
+}
+
+auto EmbeddedPython::call(std::function<void()> task) -> bool {
+    this->loaded.wait();
+    if (!this->ready) return false;
+
+    WaitableEvent done;
+    {
+        const ScopedLock sl{this->lock};
+        this->tasks.push_back([&]() {
+            task();
+            done.signal();
+        });
+    }
+    this->wakeUp.signal();
+    done.wait();
+    return true;
+}
+
+auto EmbeddedPython::request(const var& request, const std::function<void(const PythonWorker::Progress&)>& onProgress,
+    const std::function<bool()>& shouldExit, Trace* trace) -> var {
+    if (auto* obj = request.getDynamicObject(); obj != nullptr && trace != nullptr) obj->setProperty("trace", true);
+    auto text = JSON::toString(request, true);
+    auto sent = 0.0;
+    var result;
+
+    this->call([&]() {
+        ProgressBridge bridge{onProgress, shouldExit};
+        auto* callback = createProgressCallback(bridge);
+        auto* module = PyImport_AddModule("chopper");
+        if (callback == nullptr || module == nullptr) {
+            Py_XDECREF(callback);
+            PyErr_Clear();
+            return;
+        }
+
+        sent = trace != nullptr ? trace->now() : 0.0;
+        auto* output = PyObject_CallMethod(module, "run_embedded", "sO", text.toRawUTF8(), callback);
+        Py_DECREF(callback);
+        if (output == nullptr) {
+            PyErr_Clear();
+            return;
+        }
+        if (const auto* json = PyUnicode_AsUTF8(output)) result = JSON::parse(String::fromUTF8(json));
+        Py_DECREF(output);
+    });
+
+    if (trace != nullptr && result.isObject()) trace->merge(result["trace"], sent - static_cast<double>(result["trace_clock"]));
+    return result;
+}
+
+auto EmbeddedPython::separate(const AudioBuffer<float>& audio, double sampleRate, const String& model,
+    const std::function<void(const PythonWorker::Progress&)>& onProgress,
+    const std::function<bool()>& shouldExit) -> std::optional<AudioBuffer<float>> {
+    std::optional<AudioBuffer<float>> vocals;
+    auto numChannels = audio.getNumChannels();
+    auto numBytes = static_cast<Py_ssize_t>(audio.getNumSamples()) * static_cast<Py_ssize_t>(sizeof(float));
+
+    this->call([&]() {
+        ProgressBridge bridge{onProgress, shouldExit};
+        auto* callback = createProgressCallback(bridge);
+        auto* module = PyImport_AddModule("chopper");
+        auto* channels = PyTuple_New(numChannels);
+        if (callback == nullptr || module == nullptr || channels == nullptr) {
+            Py_XDECREF(callback);
+            Py_XDECREF(channels);
+            PyErr_Clear();
+            return;
+        }
+        for (int ch = 0; ch < numChannels; ch++) {
+            auto* data = reinterpret_cast<char*>(const_cast<float*>(audio.getReadPointer(ch)));
+            PyTuple_SET_ITEM(channels, ch, PyMemoryView_FromMemory(data, numBytes, PyBUF_READ));
+        }
+
+        auto* output = PyObject_CallMethod(module, "separate_embedded", "OdsO", channels, sampleRate, model.toRawUTF8(), callback);
+        Py_DECREF(channels);
+        Py_DECREF(callback);
+        if (output == nullptr) {
+            PyErr_Clear();
+            return;
+        }
+
+        Py_buffer view;
+        if (PyObject_GetBuffer(output, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) == 0) {
+            auto isFloat = view.format != nullptr && String{view.format}.getLastCharacter() == 'f';
+            if (isFloat && view.ndim == 2 && view.itemsize == static_cast<Py_ssize_t>(sizeof(float))) {
+                auto outChannels = static_cast<int>(view.shape[0]);
+                auto outSamples = static_cast<int>(view.shape[1]);
+                const auto* data = static_cast<const float*>(view.buf);
+
+                AudioBuffer<float> result{outChannels, outSamples};
+                for (int ch = 0; ch < outChannels; ch++) result.copyFrom(ch, 0, data + static_cast<size_t>(ch) * static_cast<size_t>(outSamples), outSamples);
+                vocals = std::move(result);
+            }
+            PyBuffer_Release(&view);
+        } else {
+            PyErr_Clear();
+        }
+        Py_DECREF(output);
+    });
+    return vocals;
+}
+
+#endif
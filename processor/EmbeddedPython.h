@@ -0,0 +1,38 @@
+#pragma once
+#include <JuceHeader.h>
+#include "PythonWorker.hpp"
+
+#if VOCAL_CHOPPER_EMBED_PYTHON
+
+class EmbeddedPython : private Thread {
+public:
+    EmbeddedPython();
+    ~EmbeddedPython() override;
+
+    static auto isEnabled() -> bool;
+
+    // Why the interpreter or chopper.py could not be loaded, empty once they are.
+    auto getLoadError() -> String;
+
+    auto request(const var& request, const std::function<void(const PythonWorker::Progress&)>& onProgress,
+        const std::function<bool()>& shouldExit, Trace* trace = nullptr) -> var;
+    auto separate(const AudioBuffer<float>& audio, double sampleRate, const String& model,
+        const std::function<void(const PythonWorker::Progress&)>& onProgress,
+        const std::function<bool()>& shouldExit) -> std::optional<AudioBuffer<float>>;
+
+private:
+    auto run() -> void override;
+    auto call(std::function<void()> task) -> bool;
+    auto loadModule() -> bool;
+
+    CriticalSection lock;
+    std::deque<std::function<void()>> tasks;
+    WaitableEvent wakeUp;
+    WaitableEvent loaded{true};
+    std::atomic<bool> ready{false};
+    String loadError;
+
+    JUCE_DECLARE_NON_COPYABLE(EmbeddedPython)
+};
+
+#endif
@@ -0,0 +1,270 @@
+#include "JobQueue.h"
+#include "PythonThread.hpp"
+
+auto Job::isDone() const -> bool {
+    return this->state == State::finished || this->state == State::failed || this->state == State::cancelled;
+}
+
+auto Job::toVar() const -> var {
+    auto* obj = new DynamicObject();
+    obj->setProperty("id", this->id);
+    obj->setProperty("name", this->name);
+    obj->setProperty("state", stateToString(this->state));
+    obj->setProperty("progress", this->progress);
+    obj->setProperty("eta", this->eta);
+    obj->setProperty("setup", this->setup);
+    obj->setProperty("outputFolder", this->outputFolder.getFullPathName());
+    obj->setProperty("error", this->error);
+    return var{obj};
+}
+
+auto Job::stateToString(State state) -> String {
+    switch (state) {
+        case State::queued: return "queued";
+        case State::provisioning: return "provisioning";
+        case State::separating: return "separating";
+        case State::chopping: return "chopping";
+        case State::finished: return "finished";
+        case State::failed: return "failed";
+        case State::cancelled: return "cancelled";
+    }
+    return "";
+}
+
+auto Job::canTransition(State from, State to) -> bool {
+    if (from == to) return from != State::finished && from != State::failed && from != State::cancelled;
+
+    switch (from) {
+        case State::queued: return true;
+        case State::provisioning: return to != State::queued && to != State::separating && to != State::chopping;
+        case State::separating: return to != State::queued;
+        case State::chopping: return to != State::queued && to != State::separating;
+        default: return false;
+    }
+}
+
+JobQueue::~JobQueue() {
+    if (this->pool == nullptr) return;
+    this->pool->removeAllJobs(true, 0);
+    this->wakeJobs();
+    this->pool->removeAllJobs(true, -1);
+}
+
+auto JobQueue::expandInputs(const StringArray& paths) -> Array<File> {
+    Array<File> files;
+    for (auto& path : paths) {
+        if (!File::isAbsolutePath(path)) continue;
+        File file{path};
+
+        if (file.isDirectory()) {
+            auto children = file.findChildFiles(File::findFiles, true, getAudioWildcard());
+            children.sort();
+            files.addArray(children);
+        } else if (file.existsAsFile()) {
+            files.add(file);
+        }
+    }
+    return files;
+}
+
+auto JobQueue::add(const File& input, const String& name, const File& destFolder, bool skipVocalExtraction, bool keepVocalFile,
+    const Chopper::Options& options) -> int {
+    Job job;
+    std::vector<Job> added;
+    {
+        const ScopedLock sl{this->lock};
+        if (!this->isBusy()) this->jobs.clear();
+
+        if (this->pool == nullptr) {
+            this->pool = std::make_unique<ThreadPool>(ThreadPoolOptions{}
+                .withThreadName("Python Thread")
+                .withNumberOfThreads(this->maxConcurrentJobs));
+        }
+
+        auto hasSetup = std::any_of(this->jobs.begin(), this->jobs.end(), [](auto& job) { return job.setup; });
+        if (!hasSetup && !Provisioner::isProvisioned()) {
+            Job setup;
+            setup.id = this->nextId++;
+            setup.name = "Python setup";
+            setup.setup = true;
+            this->jobs.push_back(setup);
+            this->setupDone.reset();
+            this->pool->addJob(new ProvisionThread{*this, setup.id}, true);
+            added.push_back(setup);
+        }
+
+        job.id = this->nextId++;
+        job.input = input;
+        job.name = name;
+        job.destFolder = destFolder;
+        job.skipVocalExtraction = skipVocalExtraction;
+        job.keepVocalFile = keepVocalFile;
+        job.keepTrace = this->keepTraces;
+        job.options = options;
+        job.outputFolder = Chopper::getOutputFolder(destFolder, name);
+        for (int index = 2; this->isOutputFolderTaken(job.outputFolder); index++) {
+            job.outputFolder = Chopper::getOutputFolder(destFolder, name, index);
+        }
+        this->jobs.push_back(job);
+        this->pool->addJob(new PythonThread{*this, job.id}, true);
+        added.push_back(job);
+    }
+    auto summary = this->getSummary();
+    this->listeners.call([&](Listener& listener) {
+        for (auto& changed : added) listener.jobChanged(changed);
+        listener.queueChanged(summary);
+    });
+    return job.id;
+}
+
+auto JobQueue::cancelAll() -> void {
+    if (this->pool != nullptr) {
+        this->pool->removeAllJobs(true, 0);
+        this->wakeJobs();
+    }
+
+    std::vector<Job> cancelled;
+    {
+        const ScopedLock sl{this->lock};
+        for (auto& job : this->jobs) {
+            if (job.state != Job::State::queued) continue;
+            job.state = Job::State::cancelled;
+            cancelled.push_back(job);
+        }
+    }
+    auto summary = this->getSummary();
+    this->listeners.call([&](Listener& listener) {
+        for (auto& job : cancelled) listener.jobChanged(job);
+        listener.queueChanged(summary);
+    });
+}
+
+auto JobQueue::wakeJobs() -> void {
+    this->worker.cancel();
+    Provisioner::cancel();
+}
+
+auto JobQueue::setMaxConcurrentJobs(int numJobs) -> void {
+    const ScopedLock sl{this->lock};
+    this->maxConcurrentJobs = jlimit(1, 64, numJobs);
+    if (!this->isBusy()) this->pool.reset();
+}
+
+auto JobQueue::setKeepTraces(bool shouldKeep) -> void {
+    const ScopedLock sl{this->lock};
+    this->keepTraces = shouldKeep;
+}
+
+auto JobQueue::isBusy() const -> bool {
+    const ScopedLock sl{this->lock};
+    return std::any_of(this->jobs.begin(), this->jobs.end(), [](auto& job) { return !job.isDone(); });
+}
+
+auto JobQueue::isOutputFolderTaken(const File& folder) const -> bool {
+    return std::any_of(this->jobs.begin(), this->jobs.end(), [&](auto& job) { return job.outputFolder == folder; });
+}
+
+auto JobQueue::getJob(int id) const -> Job {
+    const ScopedLock sl{this->lock};
+    for (auto& job : this->jobs) {
+        if (job.id == id) return job;
+    }
+    return {};
+}
+
+auto JobQueue::getJobs() const -> std::vector<Job> {
+    const ScopedLock sl{this->lock};
+    return this->jobs;
+}
+
+auto JobQueue::getSummary() const -> Summary {
+    const ScopedLock sl{this->lock};
+    return this->summarise();
+}
+
+auto JobQueue::summarise() const -> Summary {
+    Summary summary;
+    summary.total = static_cast<int>(this->jobs.size());
+    if (summary.total == 0) return summary;
+
+    double progress = 0.0;
+    double activeEta = 0.0;
+    double elapsed = 0.0;
+    int timed = 0;
+    int queued = 0;
+    for (auto& job : this->jobs) {
+        if (job.isDone()) summary.completed++;
+        if (job.state == Job::State::finished) summary.succeeded++;
+        if (job.state == Job::State::finished && !job.setup && job.started != Time{}) {
+            elapsed += (job.ended - job.started).inSeconds();
+            timed++;
+        }
+        if (job.state == Job::State::queued) queued++;
+        if (!job.isDone() && job.state != Job::State::queued) activeEta = jmax(activeEta, job.eta);
+        progress += job.isDone() ? 100.0 : job.progress;
+    }
+    summary.progress = progress / summary.total;
+
+    if (queued == 0) {
+        summary.eta = activeEta;
+    } else if (timed > 0) {
+        auto perJob = elapsed / timed;
+        summary.eta = activeEta + perJob * std::ceil(static_cast<double>(queued) / this->maxConcurrentJobs);
+    }
+
+    if (summary.completed == summary.total) {
+        summary.state = "finished";
+    } else {
+        auto active = std::find_if(this->jobs.begin(), this->jobs.end(), [](auto& job) { 
+            return job.state == Job::State::provisioning || job.state == Job::State::separating || job.state == Job::State::chopping;
+        });
+        summary.state = Job::stateToString(active != this->jobs.end() ? active->state : Job::State::queued);
+    }
+    auto first = std::find_if(this->jobs.begin(), this->jobs.end(), [](auto& job) { return !job.setup; });
+    auto numChopJobs = std::count_if(this->jobs.begin(), this->jobs.end(), [](auto& job) { return !job.setup; });
+    if (first != this->jobs.end()) summary.outputFolder = numChopJobs == 1 ? first->outputFolder : first->destFolder;
+    return summary;
+}
+
+auto JobQueue::fail(int id, const String& error) -> bool {
+    return this->update(id, Job::State::failed, 100, -1.0, {}, error);
+}
+
+auto JobQueue::update(int id, Job::State state, double progress, double eta, const File& outputFolder, const String& error) -> bool {
+    std::vector<Job> changed;
+    Summary summary;
+    {
+        const ScopedLock sl{this->lock};
+        auto it = std::find_if(this->jobs.begin(), this->jobs.end(), [&](auto& job) { return job.id == id; });
+        if (it == this->jobs.end() || !Job::canTransition(it->state, state)) return false;
+
+        if (it->state == Job::State::queued && state != Job::State::queued) it->started = Time::getCurrentTime();
+        it->state = state;
+        it->progress = progress;
+        it->eta = eta;
+        if (it->isDone()) it->ended = Time::getCurrentTime();
+        if (outputFolder != File{}) it->outputFolder = outputFolder;
+        if (state == Job::State::failed && error.isNotEmpty()) it->error = error;
+        changed.push_back(*it);
+
+        // Jobs queued behind a setup that did not finish can never run, they end with it.
+        if (it->setup && it->isDone()) {
+            auto setupState = it->state;
+            for (auto& job : this->jobs) {
+                if (job.setup || job.state != Job::State::queued || setupState == Job::State::finished) continue;
+                job.state = setupState == Job::State::cancelled ? Job::State::cancelled : Job::State::failed;
+                job.progress = 100.0;
+                job.ended = Time::getCurrentTime();
+                if (job.state == Job::State::failed) job.error = "Python setup failed";
+                changed.push_back(job);
+            }
+            this->setupDone.signal();
+        }
+        summary = this->summarise();
+    }
+    this->listeners.call([&](Listener& listener) {
+        for (auto& job : changed) listener.jobChanged(job);
+        listener.queueChanged(summary);
+    });
+    return true;
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <JuceHeader.h>
+#include "PythonWorker.hpp"
+#include "Chopper.h"
+
+struct Job {
+    enum class State { queued, provisioning, separating, chopping, finished, failed, cancelled };
+
+    int id = 0;
+    File input;
+    String name = "";
+    File destFolder;
+    bool skipVocalExtraction = false;
+    bool keepVocalFile = false;
+    bool keepTrace = false;
+    bool setup = false;
+    Chopper::Options options;
+    State state = State::queued;
+    double progress = 0.0;
+    double eta = -1.0;
+    File outputFolder;
+    String error = "";
+    Time started;
+    Time ended;
+
+    auto isDone() const -> bool;
+    auto toVar() const -> var;
+    static auto stateToString(State state) -> String;
+    static auto canTransition(State from, State to) -> bool;
+};
+
+class JobQueue {
+public:
+    struct Summary {
+        String state = "";
+        double progress = 100.0;
+        double eta = -1.0;
+        int completed = 0;
+        int succeeded = 0;
+        int total = 0;
+        File outputFolder;
+    };
+
+    struct Listener {
+        virtual ~Listener() = default;
+        virtual auto jobChanged([[maybe_unused]] const Job& job) -> void {}
+        virtual auto queueChanged([[maybe_unused]] const Summary& summary) -> void {}
+    };
+
+    JobQueue(PythonWorker& worker) : worker(worker) { this->setupDone.signal(); }
+    ~JobQueue();
+
+    static auto getAudioWildcard() -> String { return "*.wav;*.mp3;*.ogg;*.flac"; }
+    static auto expandInputs(const StringArray& paths) -> Array<File>;
+
+    auto add(const File& input, const String& name, const File& destFolder, bool skipVocalExtraction, bool keepVocalFile,
+        const Chopper::Options& options = {}) -> int;
+    auto cancelAll() -> void;
+    auto setMaxConcurrentJobs(int numJobs) -> void;
+    auto setKeepTraces(bool shouldKeep) -> void;
+    auto isBusy() const -> bool;
+    auto waitForSetup(int timeoutMs) const -> bool { return this->setupDone.wait(timeoutMs); }
+
+    auto getJob(int id) const -> Job;
+    auto getJobs() const -> std::vector<Job>;
+    auto getSummary() const -> Summary;
+    auto update(int id, Job::State state, double progress, double eta = -1.0, const File& outputFolder = {},
+        const String& error = {}) -> bool;
+    auto fail(int id, const String& error) -> bool;
+
+    auto addListener(Listener* listener) -> void { this->listeners.add(listener); }
+    auto removeListener(Listener* listener) -> void { this->listeners.remove(listener); }
+
+    PythonWorker& worker;
+
+private:
+    auto summarise() const -> Summary;
+    auto wakeJobs() -> void;
+    auto isOutputFolderTaken(const File& folder) const -> bool;
+
+    mutable CriticalSection lock;
+    WaitableEvent setupDone{true};
+    std::vector<Job> jobs;
+    std::unique_ptr<ThreadPool> pool;
+    ListenerList<Listener, Array<Listener*, CriticalSection>> listeners;
+    int maxConcurrentJobs = 2;
+    bool keepTraces = false;
+    int nextId = 1;
+
+    JUCE_DECLARE_NON_COPYABLE(JobQueue)
+};
@@ -1,5 +1,21 @@
 #include "Processor.h"
 #include "Editor.h"
+#include "Settings.hpp"
+#include "DropSpool.hpp"
+#include "DropStore.hpp"
+
+Processor::Processor() : AudioProcessor() {
+    this->jobQueue.setMaxConcurrentJobs(Settings::getInt("maxConcurrentJobs", 2));
+    this->jobQueue.setKeepTraces(Settings::getInt("keepJobTraces", 0) != 0);
+    this->jobQueue.addListener(this);
+}
+
+Processor::~Processor() {
+    this->capture.stop();
+    this->streamingChopper.reset();
+    for (auto& hash : this->pinnedHashes) DropStore::unpin(hash);
+    this->jobQueue.removeListener(this);
+}
 
 auto Processor::createEditor() -> AudioProcessorEditor* {
     return new Editor(*this);
@@ -8,12 +24,26 @@ auto Processor::createEditor() -> AudioProcessorEditor* {
 auto Processor::getStateInformation([[maybe_unused]] MemoryBlock& destData) -> void {
     auto* obj = new DynamicObject();
     obj->setProperty("audioPath", this->audioPath);
+    obj->setProperty("audioFiles", this->audioFiles);
+    Array<var> droppedFiles;
+    for (auto& path : this->audioFiles) {
+        if (!File::isAbsolutePath(path)) continue;
+        auto hash = DropStore::getHash(File{path});
+        if (hash.isEmpty()) continue;
+        auto* dropped = new DynamicObject();
+        dropped->setProperty("hash", hash);
+        dropped->setProperty("name", File{path}.getFileName());
+        droppedFiles.add(var{dropped});
+    }
+    obj->setProperty("droppedFiles", droppedFiles);
     obj->setProperty("destFolder", this->destFolder);
     obj->setProperty("skipVocalExtraction", this->skipVocalExtraction);
     obj->setProperty("keepVocalFile", this->keepVocalFile);
-    obj->setProperty("droppedFileBytes", this->droppedFileBytes.toBase64Encoding());
-    obj->setProperty("state", this->state);
-    obj->setProperty("progress", this->progress);
+    obj->setProperty("threshold", this->chopOptions.threshold);
+    obj->setProperty("minDuration", this->chopOptions.minDuration);
+    obj->setProperty("minRms", this->chopOptions.minRms);
+    obj->setProperty("state", this->getState());
+    obj->setProperty("progress", this->getProgress());
 
     auto jsonString = JSON::toString(var{obj});
     MemoryOutputStream(destData, true).writeString(jsonString);
@@ -27,13 +57,177 @@ auto Processor::setStateInformation([[maybe_unused]] const void* data, [[maybe_u
         this->destFolder = obj->getProperty("destFolder").toString();
         this->skipVocalExtraction = static_cast<bool>(obj->getProperty("skipVocalExtraction"));
         this->keepVocalFile = static_cast<bool>(obj->getProperty("keepVocalFile"));
-        auto base64 = obj->getProperty("droppedFileBytes").toString();
-        droppedFileBytes.fromBase64Encoding(base64);
-        this->state = obj->getProperty("state").toString();
-        this->progress = static_cast<double>(obj->getProperty("progress"));
+        Chopper::Options defaults;
+        auto& properties = obj->getProperties();
+        this->chopOptions.threshold = static_cast<float>(properties.getWithDefault("threshold", defaults.threshold));
+        this->chopOptions.minDuration = static_cast<double>(properties.getWithDefault("minDuration", defaults.minDuration));
+        this->chopOptions.minRms = static_cast<double>(properties.getWithDefault("minRms", defaults.minRms));
+        {
+            const ScopedLock sl{this->stateLock};
+            this->state = obj->getProperty("state").toString();
+            this->progress = static_cast<double>(obj->getProperty("progress"));
+        }
+
+        this->audioFiles.clear();
+        if (auto* files = obj->getProperty("audioFiles").getArray()) {
+            auto droppedFiles = obj->getProperty("droppedFiles");
+            for (auto& file : *files) {
+                if (!File::isAbsolutePath(file.toString())) continue;
+                // Dropped files are found by hash, the store folder may have moved since the session was saved.
+                File saved{file.toString()};
+                auto hash = saved.getParentDirectory().getFileName();
+                auto isDropped = droppedFiles.getArray() != nullptr && std::any_of(droppedFiles.begin(), droppedFiles.end(), [&](auto& dropped) {
+                    return dropped["hash"].toString() == hash && dropped["name"].toString() == saved.getFileName();
+                });
+                auto found = isDropped ? DropStore::find(hash, saved.getFileName()) : File{};
+                this->audioFiles.add(found != File{} ? found.getFullPathName() : file.toString());
+            }
+        } else if (this->audioPath.contains("[dropped file]")) {
+            auto name = this->audioPath.fromFirstOccurrenceOf("]", false, false).trim();
+            auto droppedFilePath = obj->getProperty("droppedFilePath").toString();
+            auto legacyBytes = obj->getProperty("droppedFileBytes").toString();
+            auto droppedFile = DropStore::find(obj->getProperty("droppedFileHash").toString(), name);
+
+            if (File::isAbsolutePath(droppedFilePath) && File{droppedFilePath}.existsAsFile()) droppedFile = File{droppedFilePath};
+            if (droppedFile == File{} && legacyBytes.isNotEmpty()) droppedFile = this->restoreDroppedFile(legacyBytes, name);
+            if (droppedFile != File{}) this->audioFiles.add(droppedFile.getFullPathName());
+        } else if (this->audioPath.isNotEmpty()) {
+            this->audioFiles.add(this->audioPath);
+        }
+        for (auto& file : this->audioFiles) {
+            if (File::isAbsolutePath(file)) DropStore::touch(File{file});
+        }
+        this->pinAudioFiles();
+    }
+}
+
+auto Processor::restoreDroppedFile(const String& base64, const String& name) -> File {
+    MemoryBlock droppedFileBytes;
+    if (base64.isEmpty() || !droppedFileBytes.fromBase64Encoding(base64)) return {};
+
+    DropSpool spool;
+    if (!spool.begin(name, static_cast<int64>(droppedFileBytes.getSize()))) return {};
+    spool.write(droppedFileBytes.getData(), droppedFileBytes.getSize());
+    return spool.finish();
+}
+
+auto Processor::pinAudioFiles() -> void {
+    StringArray hashes;
+    for (auto& path : this->audioFiles) {
+        if (File::isAbsolutePath(path)) hashes.add(DropStore::getHash(File{path}));
+    }
+    hashes.removeEmptyStrings();
+    for (auto& hash : hashes) DropStore::pin(hash);
+    for (auto& hash : this->pinnedHashes) DropStore::unpin(hash);
+    this->pinnedHashes = hashes;
+}
+
+auto Processor::getMissingInputs() const -> StringArray {
+    StringArray missing;
+    for (auto& path : this->audioFiles) {
+        if (File::isAbsolutePath(path) && !File{path}.exists()) missing.add(File{path}.getFileName());
+    }
+    return missing;
+}
+
+auto Processor::startJobs() -> int {
+    if (!File::isAbsolutePath(this->destFolder)) return 0;
+    File dest{this->destFolder};
+
+    auto inputs = JobQueue::expandInputs(this->audioFiles);
+    for (auto& input : inputs) {
+        DropStore::touch(input);
+        this->jobQueue.add(input, input.getFileName(), dest, this->skipVocalExtraction, this->keepVocalFile, this->chopOptions);
+    }
+    return inputs.size();
+}
+
+auto Processor::startCapture() -> bool {
+    if (this->capture.isRecording()) return false;
+    auto file = CaptureRecorder::createTakeFile();
+    auto model = Crepe::getShared();
+
+    this->streamingChopper.reset();
+    {
+        const ScopedLock sl{this->stateLock};
+        this->lastChop = {};
+    }
+    if (model != nullptr && File::isAbsolutePath(this->destFolder)) {
+        auto outputFolder = Chopper::getOutputFolder(File{this->destFolder}, file.getFileName());
+        this->streamingChopper = std::make_unique<StreamingChopper>(model, outputFolder, this->capture.getSampleRate(), this->chopOptions,
+            [this](const StreamingChopper::Chop& chop) {
+                {
+                    const ScopedLock sl{this->stateLock};
+                    this->lastChop = chop;
+                }
+                this->captureChanged.sendChangeMessage();
+            });
+    }
+
+    CaptureRecorder::SampleCallback onSamples = nullptr;
+    if (auto* chopper = this->streamingChopper.get()) {
+        onSamples = [chopper](const float* const* channels, int numChannels, int numSamples) {
+            chopper->append(channels, numChannels, numSamples);
+        };
+    }
+    if (this->capture.start(file, onSamples)) {
+        this->captureChanged.sendChangeMessage();
+        return true;
+    }
+    this->streamingChopper.reset();
+    return false;
+}
+
+auto Processor::stopCapture() -> bool {
+    auto file = this->capture.stop();
+    return this->finishCapture(file, this->capture.getRecordedSamples());
+}
+
+auto Processor::finishCapture(const File& file, int64 recordedSamples) -> bool {
+    if (this->streamingChopper != nullptr) this->streamingChopper->finish();
+    this->captureChanged.sendChangeMessage();
+    if (!file.existsAsFile() || recordedSamples == 0) {
+        file.deleteFile();
+        return false;
+    }
+    this->audioFiles = StringArray{file.getFullPathName()};
+    this->audioPath = "[captured] " + file.getFileName();
+    this->pinAudioFiles();
+    return true;
+}
+
+auto Processor::getState() const -> String {
+    const ScopedLock sl{this->stateLock};
+    return this->state;
+}
+
+auto Processor::getProgress() const -> double {
+    const ScopedLock sl{this->stateLock};
+    return this->progress;
+}
+
+auto Processor::getLastChop() const -> StreamingChopper::Chop {
+    const ScopedLock sl{this->stateLock};
+    return this->lastChop;
+}
+
+auto Processor::queueChanged(const JobQueue::Summary& summary) -> void {
+    auto shouldOpen = false;
+    {
+        const ScopedLock sl{this->stateLock};
+        auto wasBusy = this->state.isNotEmpty() && this->state != "finished";
+        this->state = summary.state;
+        this->progress = summary.progress;
+        shouldOpen = wasBusy && summary.state == "finished" && summary.succeeded > 0;
+    }
+
+    if (shouldOpen) {
+        MessageManager::callAsync([folder = summary.outputFolder]() {
+            if (folder.isDirectory()) folder.startAsProcess();
+        });
     }
 }
 
 auto JUCE_CALLTYPE createPluginFilter() -> AudioProcessor* {
     return new Processor();
-}
\ No newline at end of file
+}
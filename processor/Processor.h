@@ -1,14 +1,34 @@
 #pragma once
 #include <JuceHeader.h>
+#include "PythonWorker.hpp"
+#include "JobQueue.h"
+#include "WebviewAssets.hpp"
+#include "CaptureRecorder.h"
+#include "StreamingChopper.h"
+#include "ChopPreview.h"
+#include "Settings.hpp"
 
-class Processor : public AudioProcessor {
+class Processor : public AudioProcessor, private JobQueue::Listener {
 public:
-    Processor() : AudioProcessor() {}
-    ~Processor() override {}
+    Processor();
+    ~Processor() override;
     
-    auto prepareToPlay([[maybe_unused]] double sampleRate, [[maybe_unused]] int samplesPerBlock) -> void override {}
+    auto prepareToPlay(double sampleRate, int samplesPerBlock) -> void override {
+        if (!this->capture.canContinue(sampleRate, this->getTotalNumInputChannels())) {
+            // Only the recorder stops here, the take is adopted on the message thread.
+            auto file = this->capture.stop();
+            MessageManager::callAsync([processor = WeakReference<Processor>{this}, file, samples = this->capture.getRecordedSamples()]() {
+                if (processor != nullptr) processor->finishCapture(file, samples);
+            });
+        }
+        this->capture.prepare(sampleRate, samplesPerBlock, this->getTotalNumInputChannels());
+        this->preview.prepare(sampleRate, samplesPerBlock);
+    }
     auto releaseResources() -> void override {}
-    auto processBlock(AudioBuffer<float>&, MidiBuffer&) -> void override {}
+    auto processBlock(AudioBuffer<float>& buffer, MidiBuffer&) -> void override {
+        this->capture.push(buffer);
+        this->preview.render(buffer);
+    }
 
     auto isBusesLayoutSupported ([[maybe_unused]] const BusesLayout& layouts) const -> bool override { return true; }
     auto createEditor() -> AudioProcessorEditor* override;
@@ -28,15 +48,41 @@ public:
 
     auto getStateInformation([[maybe_unused]] MemoryBlock& destData) -> void override;
     auto setStateInformation([[maybe_unused]] const void* data, [[maybe_unused]] int sizeInBytes) -> void override;
+    auto restoreDroppedFile(const String& base64, const String& name) -> File;
+    auto startJobs() -> int;
+    auto pinAudioFiles() -> void;
+    auto getMissingInputs() const -> StringArray;
+    auto startCapture() -> bool;
+    auto stopCapture() -> bool;
+    auto getState() const -> String;
+    auto getProgress() const -> double;
+    auto getLastChop() const -> StreamingChopper::Chop;
 
     String audioPath = "";
+    StringArray audioFiles;
     String destFolder = "";
     bool skipVocalExtraction = false;
     bool keepVocalFile = false;
-    MemoryBlock droppedFileBytes;
+    Chopper::Options chopOptions;
+    SharedResourcePointer<Settings> settings;
+    SharedResourcePointer<PythonWorker> pythonWorker;
+    SharedResourcePointer<WebviewAssets> webviewAssets;
+    JobQueue jobQueue{*this->pythonWorker};
+    CaptureRecorder capture;
+    std::unique_ptr<StreamingChopper> streamingChopper;
+    ChangeBroadcaster captureChanged;
+    ChopPreview preview;
+
+private:
+    auto queueChanged(const JobQueue::Summary& summary) -> void override;
+    auto finishCapture(const File& file, int64 recordedSamples) -> bool;
+
+    StringArray pinnedHashes;
+    mutable CriticalSection stateLock;
     String state = "";
     double progress = 100.0;
+    StreamingChopper::Chop lastChop;
 
-private:
+    JUCE_DECLARE_WEAK_REFERENCEABLE(Processor)
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Processor)
 };
\ No newline at end of file
@@ -0,0 +1,125 @@
+#pragma once
+#include <JuceHeader.h>
+#include "PythonWorker.hpp"
+
+class Provisioner {
+public:
+    static constexpr int version = 2;
+    static constexpr int pollIntervalMs = 250;
+
+    static auto getMarkerFile() -> File {
+        return File::getSpecialLocation(File::userApplicationDataDirectory)
+            .getChildFile(JucePlugin_Manufacturer)
+            .getChildFile(JucePlugin_Name)
+            .getChildFile("python-env.json");
+    }
+
+    static auto isProvisioned() -> bool {
+        auto& provisioned = getProvisioned();
+        if (provisioned.load()) return true;
+
+        auto marker = JSON::parse(getMarkerFile());
+        auto valid = static_cast<int>(marker["version"]) == version && marker["python"].toString() == PythonWorker::getPythonPath();
+        provisioned.store(valid);
+        return valid;
+    }
+
+    // Hosts often load several plugin instances at once, only one of them installs while the others wait for it.
+    static auto provision(const std::function<void(double)>& onProgress, const std::function<bool()>& shouldExit, String& error) -> bool {
+        InterProcessLock processLock{"VocalChopperProvision"};
+        while (!processLock.enter(pollIntervalMs)) {
+            if (shouldExit()) return false;
+        }
+        auto provisioned = isProvisioned() || install(onProgress, shouldExit, error);
+        processLock.exit();
+        return provisioned;
+    }
+
+    // Kills a running install so the provisioning thread's blocking read returns.
+    static auto cancel() -> void {
+        auto& active = getActive();
+        const ScopedLock sl{active.lock};
+        if (active.process != nullptr) active.process->kill();
+    }
+
+private:
+    struct Active {
+        CriticalSection lock;
+        ChildProcess* process = nullptr;
+    };
+
+    static auto install(const std::function<void(double)>& onProgress, const std::function<bool()>& shouldExit, String& error) -> bool {
+        auto script = PythonWorker::extractScript();
+        getMarkerFile().getParentDirectory().createDirectory();
+
+        ChildProcess process;
+        StringArray argv{PythonWorker::getPythonPath(), script.getFullPathName(), "--provision"};
+        if (!process.start(argv, ChildProcess::wantStdOut)) {
+            error = "Could not start " + PythonWorker::getPythonPath();
+            return false;
+        }
+        auto& active = getActive();
+        {
+            const ScopedLock sl{active.lock};
+            active.process = &process;
+        }
+        if (shouldExit()) process.kill();
+
+        LineBuffer lines;
+        String line;
+        String lastLine;
+        String failure;
+        var interpreter;
+        char byte = 0;
+        while (process.readProcessOutput(&byte, 1) == 1) {
+            lines.append(&byte, 1);
+            while (lines.next(line)) {
+                auto message = JSON::parse(line);
+                auto type = message["type"].toString();
+                if (type == "progress") {
+                    onProgress(PythonWorker::Progress::fromVar(message).fraction);
+                } else if (type == "error") {
+                    failure = message["message"].toString();
+                } else if (type == "result") {
+                    interpreter = message;
+                } else if (line.isNotEmpty()) {
+                    lastLine = line;
+                }
+            }
+        }
+        process.waitForProcessToFinish(-1);
+        {
+            const ScopedLock sl{active.lock};
+            active.process = nullptr;
+        }
+        if (shouldExit()) return false;
+
+        if (!interpreter.isObject() || process.getExitCode() != 0) {
+            if (failure.isEmpty()) failure = lastLine;
+            error = failure.isNotEmpty() ? failure : "Python setup exited with code " + String{process.getExitCode()};
+            return false;
+        }
+
+        auto* marker = new DynamicObject();
+        marker->setProperty("version", version);
+        marker->setProperty("python", PythonWorker::getPythonPath());
+        for (auto key : {"home", "executable", "paths", "python_version"}) marker->setProperty(key, interpreter[key]);
+        marker->setProperty("provisioned", Time::getCurrentTime().toISO8601(true));
+        if (!getMarkerFile().replaceWithText(JSON::toString(var{marker}))) {
+            error = "Could not write " + getMarkerFile().getFullPathName();
+            return false;
+        }
+        getProvisioned().store(true);
+        return true;
+    }
+
+    static auto getActive() -> Active& {
+        static Active active;
+        return active;
+    }
+
+    static auto getProvisioned() -> std::atomic<bool>& {
+        static std::atomic<bool> provisioned{false};
+        return provisioned;
+    }
+};
@@ -0,0 +1,320 @@
+#pragma once
+#include <JuceHeader.h>
+#include "JobQueue.h"
+#include "PythonWorker.hpp"
+#include "AudioLoader.hpp"
+#include "Crepe.h"
+#include "Chopper.h"
+#include "ContentHash.hpp"
+#include "StemCache.hpp"
+#include "Trace.hpp"
+#include "Provisioner.hpp"
+#include "EmbeddedPython.h"
+
+class PythonThread : public ThreadPoolJob {
+public:
+    PythonThread(JobQueue& queue, int jobId) : ThreadPoolJob("Python Thread"), queue(queue), jobId(jobId) {}
+
+    auto runJob() -> JobStatus override {
+        while (!this->queue.waitForSetup(Provisioner::pollIntervalMs)) {
+            if (this->shouldExit()) {
+                this->queue.update(this->jobId, Job::State::cancelled, 100);
+                return jobHasFinished;
+            }
+        }
+        if (this->queue.getJob(this->jobId).isDone()) return jobHasFinished;
+
+        auto job = this->queue.getJob(this->jobId);
+        auto audioPath = job.input.getFullPathName();
+        auto destFolder = job.destFolder.getFullPathName();
+        File vocalFile = File::getSpecialLocation(File::tempDirectory).getChildFile("vocals-" + String{this->jobId} + "-" + Uuid().toString() + ".wav");
+        auto vocalPath = vocalFile.getFullPathName();
+        bool skipVocalExtraction = job.skipVocalExtraction;
+        bool keepVocalFile = job.keepVocalFile;
+        auto outputDir = job.outputFolder;
+        auto& worker = this->queue.worker;
+        auto shouldExit = [this]() { return this->shouldExit(); };
+        if (job.keepTrace) this->trace = std::make_unique<Trace>();
+        auto* trace = this->trace.get();
+
+        String hash;
+        File cachedFile;
+        {
+            const Trace::Span span{trace, "cache.lookup"};
+            hash = ContentHash::ofFile(job.input);
+            if (!skipVocalExtraction) cachedFile = StemCache::find(hash);
+        }
+    
+        #if VOCAL_CHOPPER_EMBED_PYTHON
+            if (!skipVocalExtraction && !cachedFile.existsAsFile() && EmbeddedPython::isEnabled()) {
+                if (this->separateEmbedded(job, hash, outputDir, shouldExit)) return this->finish(job, outputDir);
+                cachedFile = StemCache::find(hash);
+            }
+        #endif
+
+        if (!skipVocalExtraction && cachedFile.existsAsFile()) {
+            vocalPath = cachedFile.getFullPathName();
+        } else if (!skipVocalExtraction) {
+            if (this->setState(Job::State::separating, 0)) {
+                auto* request = new DynamicObject();
+                request->setProperty("command", "separate");
+                request->setProperty("input", audioPath);
+                request->setProperty("output", vocalPath);
+                request->setProperty("model", StemCache::modelName);
+
+                const Trace::Span span{trace, "separate"};
+                auto reply = worker.request(var{request}, [this](const PythonWorker::Progress& progress) {
+                    this->setState(Job::State::separating, jmin(99.0, progress.fraction * 100.0) / 2, progress.eta);
+                }, shouldExit, trace);
+                if (this->checkReply(reply, "Vocal separation failed") && !vocalFile.existsAsFile()) {
+                    this->fail("Vocal separation did not write " + vocalFile.getFileName());
+                }
+                if (this->error.isEmpty() && !this->shouldExit() && hash.isNotEmpty()) {
+                    const Trace::Span store{trace, "cache.store"};
+                    StemCache::store(hash, vocalFile);
+                }
+            }
+        } else {
+            vocalPath = audioPath;
+        }
+        
+        if (this->error.isEmpty() && !this->shouldExit() && this->setState(Job::State::chopping, skipVocalExtraction ? 0 : 50)) {
+            if (!this->chopNatively(File{vocalPath}, job, hash, worker, shouldExit) && this->error.isEmpty() && !this->shouldExit()) {
+                auto framesFile = StemCache::getFramesFile(hash, !skipVocalExtraction);
+                auto* request = new DynamicObject();
+                request->setProperty("command", "chop");
+                request->setProperty("input", vocalPath);
+                request->setProperty("output", destFolder);
+                request->setProperty("name", job.name);
+                request->setProperty("folder", outputDir.getFullPathName());
+                request->setProperty("threshold", job.options.threshold);
+                request->setProperty("min_duration", job.options.minDuration);
+                request->setProperty("min_rms", job.options.minRms);
+                if (framesFile.existsAsFile()) request->setProperty("frames", framesFile.getFullPathName());
+
+                const Trace::Span span{trace, "chop.python"};
+                auto reply = worker.request(var{request}, [this](const PythonWorker::Progress& progress) {
+                    this->setChopProgress(progress.fraction, progress.eta);
+                }, shouldExit, trace);
+                if (this->checkReply(reply, "Chopping failed")) this->wroteOutput = static_cast<int>(reply["output"]["chops"]) > 0;
+            }
+        }
+
+        if (!skipVocalExtraction) {
+            const Trace::Span span{trace, "vocals.cleanup"};
+            File vocals{vocalPath};
+            auto newDest = outputDir.getChildFile("vocals.wav");
+            if (vocals == cachedFile) {
+                if (keepVocalFile && outputDir.isDirectory()) vocals.copyFileTo(newDest);
+            } else if (keepVocalFile && vocals.existsAsFile() && outputDir.isDirectory()) {
+                vocals.moveFileTo(newDest);
+            } else {
+                if (vocals.existsAsFile()) vocals.deleteFile();
+            }
+        }
+
+        return this->finish(job, outputDir);
+    }
+    
+private:
+    auto finish(const Job& job, const File& outputDir) -> JobStatus {
+        if (this->trace != nullptr && outputDir.isDirectory()) {
+            this->trace->complete(job.name, "job", 0.0, this->trace->now());
+            this->trace->write(outputDir.getChildFile("trace.json"));
+        }
+
+        if (this->shouldExit()) {
+            this->queue.update(this->jobId, Job::State::cancelled, 100);
+        } else if (this->error.isEmpty() && this->wroteOutput) {
+            this->queue.update(this->jobId, Job::State::finished, 100, 0.0, outputDir);
+        } else {
+            this->queue.fail(this->jobId, this->error.isNotEmpty() ? this->error : "No chops were written");
+        }
+        return jobHasFinished;
+    }
+
+    auto fail(const String& message) -> void {
+        if (this->error.isEmpty()) this->error = message;
+    }
+
+    auto checkReply(const var& reply, const String& context) -> bool {
+        if (reply["type"].toString() == "result") return true;
+        if (this->shouldExit()) return false;
+        auto message = reply["type"].toString() == "error" ? reply["message"].toString() : String{"the python worker stopped responding"};
+        this->fail(context + ": " + message);
+        return false;
+    }
+
+    auto checkExport(int written, size_t expected, const File& outputDir) -> void {
+        if (written < 0) {
+            this->fail("Could not write chops to " + outputDir.getFullPathName());
+        } else if (static_cast<size_t>(written) < expected) {
+            this->fail("Wrote " + String{written} + " of " + String{static_cast<int>(expected)} + " chops");
+        } else {
+            this->wroteOutput = true;
+        }
+    }
+
+    auto setState(Job::State state, double progress, double eta = -1.0) -> bool {
+        return this->queue.update(this->jobId, state, progress, eta);
+    }
+
+    auto setChopProgress(double fraction, double eta) -> void {
+        auto job = this->queue.getJob(this->jobId);
+        auto start = job.skipVocalExtraction ? 0.0 : 50.0;
+        auto percent = start + fraction * (100.0 - start);
+        if (percent >= 100.0) percent = 99.0;
+        this->setState(Job::State::chopping, percent, eta);
+    }
+
+    auto loadModel(PythonWorker& worker, const std::function<bool()>& shouldExit) -> std::shared_ptr<Crepe> {
+        auto model = Crepe::getShared();
+        if (model != nullptr) return model;
+
+        auto* request = new DynamicObject();
+        request->setProperty("command", "export_crepe");
+        request->setProperty("output", Crepe::getModelFile().getFullPathName());
+        const Trace::Span span{this->trace.get(), "crepe.export"};
+        auto reply = worker.request(var{request}, [](const PythonWorker::Progress&) {}, shouldExit, this->trace.get());
+        if (reply["type"].toString() != "result") return nullptr;
+        return Crepe::getShared();
+    }
+
+    auto chopNatively(const File& input, const Job& job, const String& hash, PythonWorker& worker, 
+        const std::function<bool()>& shouldExit) -> bool {
+        auto reader = AudioLoader::createReader(input);
+        if (reader == nullptr || reader->lengthInSamples <= 0 || reader->sampleRate <= 0.0) return false;
+        AudioFormatReaderSource source{reader.get(), false};
+
+        auto chops = this->findChops(source, static_cast<int>(reader->numChannels), reader->sampleRate, job, hash, worker, shouldExit);
+        if (!chops.has_value()) return false;
+        if (shouldExit()) return true;
+
+        const Trace::Span span{this->trace.get(), "export"};
+        this->checkExport(Chopper::exportSourceChops(input, Crepe::sampleRate, *chops, job.outputFolder), chops->size(), job.outputFolder);
+        return true;
+    }
+
+    auto findChops(PositionableAudioSource& source, int numChannels, double sourceRate, const Job& job, const String& hash, 
+        PythonWorker& worker, const std::function<bool()>& shouldExit) -> std::optional<std::vector<ChopRegion>> {
+        auto* trace = this->trace.get();
+        auto total = AudioLoader::getMonoLength(source, sourceRate, Crepe::sampleRate);
+        if (total >= AudioLoader::maxSamples) return std::nullopt;
+
+        auto separated = !job.skipVocalExtraction;
+        auto frames = StemCache::findFrames(hash, separated);
+        if (!frames.has_value()) {
+            auto model = this->loadModel(worker, shouldExit);
+            if (model == nullptr || shouldExit()) return std::nullopt;
+
+            const Trace::Span span{trace, "crepe.predict"};
+            auto start = Time::getMillisecondCounterHiRes();
+            Crepe::ConfidenceStream stream{*model};
+            int64 streamed = 0;
+            AudioLoader::streamMono(source, numChannels, sourceRate, Crepe::sampleRate, 0, total, [&](const float* samples, int numSamples) {
+                stream.push(samples, numSamples);
+                streamed += numSamples;
+                auto elapsed = (Time::getMillisecondCounterHiRes() - start) / 1000.0;
+                auto eta = elapsed / static_cast<double>(streamed) * static_cast<double>(total - streamed);
+                this->setChopProgress(static_cast<double>(streamed) / static_cast<double>(total), eta);
+                return !shouldExit();
+            });
+            if (shouldExit()) return std::vector<ChopRegion>{};
+            frames = stream.finish();
+            StemCache::storeFrames(hash, separated, *frames);
+        }
+
+        const Trace::Span span{trace, "segment"};
+        auto regions = Chopper::findRegions(frames->conf, Crepe::sampleRate, job.options);
+        return Chopper::selectChops(source, numChannels, sourceRate, Crepe::sampleRate, regions, job.options);
+    }
+
+    #if VOCAL_CHOPPER_EMBED_PYTHON
+        auto separateEmbedded(const Job& job, const String& hash, const File& outputDir, 
+            const std::function<bool()>& shouldExit) -> bool {
+            auto* trace = this->trace.get();
+            if (!this->setState(Job::State::separating, 0)) return true;
+
+            double sampleRate = 0.0;
+            std::optional<AudioBuffer<float>> source;
+            {
+                const Trace::Span span{trace, "audio.load"};
+                source = AudioLoader::loadNative(job.input, sampleRate);
+            }
+            if (!source.has_value()) return false;
+
+            SharedResourcePointer<EmbeddedPython> python;
+            std::optional<AudioBuffer<float>> vocals;
+            {
+                const Trace::Span span{trace, "separate"};
+                vocals = python->separate(*source, sampleRate, StemCache::modelName, [this](const PythonWorker::Progress& progress) {
+                    this->setState(Job::State::separating, jmin(99.0, progress.fraction * 100.0) / 2, progress.eta);
+                }, shouldExit);
+            }
+            if (shouldExit()) return true;
+            if (!vocals.has_value()) {
+                auto loadError = python->getLoadError();
+                if (loadError.isEmpty()) return false;
+                this->fail("Embedded python: " + loadError);
+                return true;
+            }
+            source.reset();
+
+            File stored;
+            if (hash.isNotEmpty()) {
+                const Trace::Span span{trace, "cache.store"};
+                stored = StemCache::store(hash, *vocals, sampleRate);
+            }
+
+            if (!this->setState(Job::State::chopping, 50)) return true;
+            MemoryAudioSource analysis{*vocals, false};
+            auto chops = this->findChops(analysis, vocals->getNumChannels(), sampleRate, job, hash, this->queue.worker, shouldExit);
+            if (shouldExit()) return true;
+            if (!chops.has_value()) {
+                // The cached stem then goes through the worker's chop like any other cache hit.
+                if (stored.existsAsFile()) return false;
+                this->fail("Could not find chops natively or cache the vocals for the python worker");
+                return true;
+            }
+
+            {
+                const Trace::Span span{trace, "export"};
+                this->checkExport(Chopper::exportBufferChops(*vocals, sampleRate, Crepe::sampleRate, *chops, outputDir), chops->size(), outputDir);
+            }
+            if (job.keepVocalFile) Chopper::writeChop(outputDir.getChildFile("vocals.wav"), *vocals, sampleRate, 24);
+            return true;
+        }
+    #endif
+
+    JobQueue& queue;
+    int jobId = 0;
+    std::unique_ptr<Trace> trace;
+    String error = "";
+    bool wroteOutput = false;
+};
+
+class ProvisionThread : public ThreadPoolJob {
+public:
+    ProvisionThread(JobQueue& queue, int jobId) : ThreadPoolJob("Provision Thread"), queue(queue), jobId(jobId) {}
+
+    auto runJob() -> JobStatus override {
+        this->queue.update(this->jobId, Job::State::provisioning, 0);
+        String error;
+        auto provisioned = Provisioner::provision([this](double fraction) {
+            this->queue.update(this->jobId, Job::State::provisioning, jmin(99.0, fraction * 100.0));
+        }, [this]() { return this->shouldExit(); }, error);
+
+        if (this->shouldExit()) {
+            this->queue.update(this->jobId, Job::State::cancelled, 100);
+        } else if (provisioned) {
+            this->queue.update(this->jobId, Job::State::finished, 100);
+        } else {
+            this->queue.fail(this->jobId, error.isNotEmpty() ? error : "Python setup failed");
+        }
+        return jobHasFinished;
+    }
+
+private:
+    JobQueue& queue;
+    int jobId = 0;
+};
@@ -0,0 +1,202 @@
+#pragma once
+#include <JuceHeader.h>
+#include <random>
+#include "BinaryData.h"
+#include "LineBuffer.hpp"
+#include "Trace.hpp"
+
+class PythonWorker {
+public:
+    struct Progress {
+        String stage = "";
+        double fraction = 0.0;
+        double eta = -1.0;
+        int64 frames = 0;
+        int64 total = 0;
+        double throughput = 0.0;
+
+        static auto fromVar(const var& message) -> Progress {
+            return {message["stage"].toString(), static_cast<double>(message["fraction"]), 
+                static_cast<double>(message["eta"]), static_cast<int64>(message["frames"]), 
+                static_cast<int64>(message["total"]), static_cast<double>(message["throughput"])};
+        }
+    };
+
+    ~PythonWorker() { this->stop(); }
+
+    static auto getPythonPath() -> String {
+        #if JUCE_MAC
+            return "/usr/local/bin/python3";
+        #else
+            return "python3";
+        #endif
+    }
+
+    static auto getScriptFile() -> File {
+        return File::getSpecialLocation(File::tempDirectory).getChildFile("chopper.py");
+    }
+
+    static auto extractScript() -> File {
+        auto script = getScriptFile();
+        script.replaceWithData(BinaryData::chopper_py, BinaryData::chopper_pySize);
+        return script;
+    }
+
+    // Requests are serialised on one worker process, concurrent jobs wait here for the previous request to finish.
+    auto request(const var& request, const std::function<void(const Progress&)>& onProgress,
+        const std::function<bool()>& shouldExit, Trace* trace = nullptr) -> var {
+        const ScopedLock sl{this->lock};
+        {
+            const Trace::Span span{this->isRunning() ? nullptr : trace, "worker.start", "python"};
+            if (!this->start(shouldExit)) return {};
+        }
+
+        auto id = this->nextId++;
+        if (auto* obj = request.getDynamicObject()) {
+            obj->setProperty("id", id);
+            if (trace != nullptr) obj->setProperty("trace", true);
+        }
+        auto sent = trace != nullptr ? trace->now() : 0.0;
+
+        auto text = JSON::toString(request, true) + "\n";
+        auto size = static_cast<int>(text.getNumBytesAsUTF8());
+        if (this->connection->write(text.toRawUTF8(), size) != size) {
+            this->stop();
+            return {};
+        }
+
+        String line;
+        String lastOutput;
+        while (this->readLine(line, shouldExit)) {
+            auto message = JSON::parse(line);
+            auto type = message["type"].toString();
+
+            if (type == "progress" && static_cast<int>(message["id"]) == id) {
+                onProgress(Progress::fromVar(message));
+            } else if (type == "output") {
+                lastOutput = message["text"].toString();
+            } else if ((type == "result" || type == "error") && static_cast<int>(message["id"]) == id) {
+                if (trace != nullptr) trace->merge(message["trace"], sent - static_cast<double>(message["trace_clock"]));
+                return message;
+            }
+        }
+        this->stop();
+        if (shouldExit() || lastOutput.isEmpty()) return {};
+
+        // The worker's last printed line is usually the reason it stopped.
+        auto* error = new DynamicObject();
+        error->setProperty("type", "error");
+        error->setProperty("id", id);
+        error->setProperty("message", "the python worker stopped: " + lastOutput);
+        return var{error};
+    }
+
+    auto stop() -> void {
+        {
+            const ScopedLock sl{this->socketLock};
+            if (this->connection != nullptr) this->connection->close();
+            this->connection.reset();
+            this->listener.reset();
+        }
+        if (this->process.isRunning()) this->process.kill();
+        this->lines.clear();
+    }
+
+    // Closing the sockets wakes a request blocked on the worker, call it after signalling its job to exit.
+    auto cancel() -> void {
+        const ScopedLock sl{this->socketLock};
+        if (this->connection != nullptr) this->connection->close();
+        if (this->listener != nullptr) this->listener->close();
+    }
+
+private:
+    auto isRunning() -> bool {
+        return this->connection != nullptr && this->connection->isConnected() && this->process.isRunning();
+    }
+
+    auto start(const std::function<bool()>& shouldExit) -> bool {
+        if (this->isRunning()) return true;
+        this->stop();
+        if (shouldExit()) return false;
+
+        auto script = extractScript();
+
+        {
+            const ScopedLock sl{this->socketLock};
+            this->listener = std::make_unique<StreamingSocket>();
+        }
+        if (!this->listener->createListener(0, "127.0.0.1")) return false;
+
+        auto port = String{this->listener->getBoundPort()};
+        auto token = createToken();
+        StringArray argv{getPythonPath(), script.getFullPathName(), "--worker", "--port", port, "--token", token};
+        if (!this->process.start(argv, 0)) return false;
+
+        while (!shouldExit() && this->process.isRunning()) {
+            auto ready = this->listener->waitUntilReady(true, startCheckInterval);
+            if (ready < 0) break;
+            if (ready == 0) continue;
+            std::unique_ptr<StreamingSocket> accepted{this->listener->waitForNextConnection()};
+            {
+                const ScopedLock sl{this->socketLock};
+                this->connection = std::move(accepted);
+            }
+            if (this->connection != nullptr && !shouldExit() && this->authenticate(token, shouldExit)) break;
+            {
+                const ScopedLock sl{this->socketLock};
+                this->connection.reset();
+            }
+            this->lines.clear();
+        }
+        {
+            const ScopedLock sl{this->socketLock};
+            this->listener.reset();
+        }
+        if (!this->isRunning()) this->stop();
+        return this->isRunning();
+    }
+
+    auto authenticate(const String& token, const std::function<bool()>& shouldExit) -> bool {
+        String line;
+        if (!this->readLine(line, shouldExit, Time::getMillisecondCounter() + handshakeTimeout)) return false;
+        auto message = JSON::parse(line);
+        return message["type"].toString() == "hello" && message["token"].toString() == token;
+    }
+
+    static auto createToken() -> String {
+        std::random_device device;
+        String token;
+        for (int i = 0; i < 8; i++) token << String::toHexString(static_cast<int>(device())).paddedLeft('0', 8);
+        return token;
+    }
+
+    // Blocks on the socket until a line arrives, the worker exits or cancel() closes the connection.
+    auto readLine(String& line, const std::function<bool()>& shouldExit, uint32 deadline = 0) -> bool {
+        while (!shouldExit()) {
+            if (this->lines.next(line)) return true;
+            if (!this->isRunning()) return false;
+
+            if (deadline > 0) {
+                auto now = Time::getMillisecondCounter();
+                if (now >= deadline || this->connection->waitUntilReady(true, static_cast<int>(deadline - now)) != 1) return false;
+            }
+
+            auto read = this->connection->read(this->buffer.getData(), static_cast<int>(this->buffer.getSize()), false);
+            if (read <= 0) return false;
+            this->lines.append(static_cast<const char*>(this->buffer.getData()), static_cast<size_t>(read));
+        }
+        return false;
+    }
+
+    static constexpr int startCheckInterval = 100;
+    static constexpr uint32 handshakeTimeout = 5000;
+
+    CriticalSection lock;
+    CriticalSection socketLock;
+    ChildProcess process;
+    std::unique_ptr<StreamingSocket> listener;
+    std::unique_ptr<StreamingSocket> connection;
+    MemoryBlock buffer{1 << 16};
+    LineBuffer lines;
+    int nextId = 1;
+};
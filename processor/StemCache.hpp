@@ -0,0 +1,138 @@
+#pragma once
+#include <JuceHeader.h>
+#include "Settings.hpp"
+#include "Crepe.h"
+#include "Chopper.h"
+
+class StemCache {
+public:
+    static constexpr const char* modelName = "htdemucs";
+    static constexpr int version = 1;
+
+    static auto getCacheFolder() -> File {
+        return File::getSpecialLocation(File::userApplicationDataDirectory)
+            .getChildFile(JucePlugin_Manufacturer)
+            .getChildFile(JucePlugin_Name)
+            .getChildFile("stems");
+    }
+
+    static auto getMaxBytes() -> int64 {
+        auto megabytes = Settings::getInt64("stemCacheMegabytes", 4096);
+        return jmax<int64>(0, megabytes) * 1024 * 1024;
+    }
+
+    static auto getEntryFolder(const String& hash) -> File {
+        if (hash.isEmpty()) return {};
+        return getCacheFolder().getChildFile(hash + "-" + modelName + "-v" + String{version});
+    }
+
+    static auto getFramesFile(const String& hash, bool separated) -> File {
+        if (hash.isEmpty()) return {};
+        auto folder = separated ? getEntryFolder(hash) : getCacheFolder().getChildFile(hash + "-source-v" + String{version});
+        return folder.getChildFile("pitch.vcpf");
+    }
+
+    static auto findFrames(const String& hash, bool separated) -> std::optional<PitchFrames> {
+        const ScopedLock sl{getLock()};
+        auto file = getFramesFile(hash, separated);
+        if (!file.existsAsFile()) return std::nullopt;
+        file.setLastModificationTime(Time::getCurrentTime());
+        return PitchFrames::load(file);
+    }
+
+    static auto storeFrames(const String& hash, bool separated, const PitchFrames& frames) -> bool {
+        auto file = getFramesFile(hash, separated);
+        if (file == File{}) return false;
+
+        const ScopedLock sl{getLock()};
+        file.getParentDirectory().createDirectory();
+        auto temp = file.getSiblingFile("pitch-" + Uuid().toString() + ".part");
+        if (!frames.save(temp) || !temp.moveFileTo(file)) {
+            temp.deleteFile();
+            return false;
+        }
+        evict(getMaxBytes());
+        return true;
+    }
+
+    static auto find(const String& hash) -> File {
+        const ScopedLock sl{getLock()};
+        auto file = getEntryFolder(hash).getChildFile("vocals.wav");
+        if (!file.existsAsFile()) return {};
+        file.setLastModificationTime(Time::getCurrentTime());
+        return file;
+    }
+
+    static auto store(const String& hash, const File& vocals) -> File {
+        auto folder = getEntryFolder(hash);
+        if (folder == File{} || !vocals.existsAsFile()) return {};
+
+        auto maxBytes = getMaxBytes();
+        if (vocals.getSize() > maxBytes) return {};
+
+        const ScopedLock sl{getLock()};
+        folder.createDirectory();
+        auto temp = folder.getChildFile("vocals-" + Uuid().toString() + ".part");
+        auto file = folder.getChildFile("vocals.wav");
+        if (!vocals.copyFileTo(temp) || !temp.moveFileTo(file)) {
+            temp.deleteFile();
+            return {};
+        }
+        file.setLastModificationTime(Time::getCurrentTime());
+        evict(maxBytes);
+        return file;
+    }
+
+    static auto store(const String& hash, const AudioBuffer<float>& vocals, double sampleRate) -> File {
+        auto folder = getEntryFolder(hash);
+        if (folder == File{} || vocals.getNumSamples() == 0) return {};
+
+        auto maxBytes = getMaxBytes();
+        if (static_cast<int64>(vocals.getNumSamples()) * vocals.getNumChannels() * 3 > maxBytes) return {};
+
+        const ScopedLock sl{getLock()};
+        folder.createDirectory();
+        auto temp = folder.getChildFile("vocals-" + Uuid().toString() + ".part");
+        auto file = folder.getChildFile("vocals.wav");
+        if (!Chopper::writeChop(temp, vocals, sampleRate, 24) || !temp.moveFileTo(file)) {
+            temp.deleteFile();
+            return {};
+        }
+        evict(maxBytes);
+        return file;
+    }
+
+    static auto evict(int64 maxBytes) -> void {
+        const ScopedLock sl{getLock()};
+        struct Entry { File folder; Time lastUsed; int64 size; };
+        std::vector<Entry> entries;
+        int64 total = 0;
+
+        for (auto& folder : getCacheFolder().findChildFiles(File::findDirectories, false)) {
+            Entry entry{folder, {}, 0};
+            for (auto& file : folder.findChildFiles(File::findFiles, false)) {
+                entry.lastUsed = jmax(entry.lastUsed, file.getLastModificationTime());
+                entry.size += file.getSize();
+            }
+            if (entry.size == 0) {
+                folder.deleteRecursively();
+                continue;
+            }
+            entries.push_back(entry);
+            total += entry.size;
+        }
+
+        std::sort(entries.begin(), entries.end(), [](auto& a, auto& b) { return a.lastUsed < b.lastUsed; });
+        for (auto& entry : entries) {
+            if (total <= maxBytes) break;
+            entry.folder.deleteRecursively();
+            total -= entry.size;
+        }
+    }
+
+private:
+    static auto getLock() -> CriticalSection& {
+        static CriticalSection lock;
+        return lock;
+    }
+};
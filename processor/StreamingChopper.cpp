@@ -0,0 +1,147 @@
+#include "StreamingChopper.h"
+
+StreamingChopper::StreamingChopper(std::shared_ptr<Crepe> model, const File& outputFolder, double sourceRate,
+    const Chopper::Options& options, std::function<void(const Chop&)> onChop) : Thread("Streaming Chopper"), 
+    model(std::move(model)), outputFolder(outputFolder), sourceRate(sourceRate), options(options), onChop(std::move(onChop)) {
+    // Offline chopping splits after maxGap unvoiced CREPE frames, the streaming hop is a whole divisor of that
+    // gap so both split on the same silence. A gap with no divisor up to the max stride rounds up to whole hops.
+    auto gapFrames = jmax(0, roundToInt(options.maxGap * options.hopSeconds * Crepe::sampleRate / Crepe::hopSize));
+    auto stride = getAnalysisStride(gapFrames);
+    this->analysisHop = Crepe::hopSize * stride;
+    this->maxGap = (gapFrames + stride - 1) / stride;
+
+    if (this->outputFolder.exists()) this->outputFolder.deleteRecursively();
+    this->outputFolder.createDirectory();
+    this->startThread();
+}
+
+StreamingChopper::~StreamingChopper() {
+    this->stopThread(-1);
+}
+
+auto StreamingChopper::getAnalysisStride(int gapFrames) -> int {
+    for (int stride = maxAnalysisStride; stride > 1; stride--) {
+        if (gapFrames % stride == 0) return stride;
+    }
+    return maxAnalysisStride;
+}
+
+auto StreamingChopper::append(const float* const* channels, int numChannels, int numSamples) -> void {
+    if (numChannels <= 0 || numSamples <= 0) return;
+    {
+        const ScopedLock sl{this->lock};
+        auto offset = this->input.size();
+        this->input.resize(offset + static_cast<size_t>(numSamples));
+        for (int i = 0; i < numSamples; i++) {
+            float sum = 0.0f;
+            for (int channel = 0; channel < numChannels; channel++) sum += channels[channel][i];
+            this->input[offset + static_cast<size_t>(i)] = sum / static_cast<float>(numChannels);
+        }
+
+        auto ratio = this->sourceRate / Crepe::sampleRate;
+        auto numOut = static_cast<int>(std::floor(static_cast<double>(this->input.size()) / ratio)) - 2;
+        if (numOut <= 0) return;
+
+        this->resampled.resize(static_cast<size_t>(numOut));
+        auto used = this->interpolator.process(ratio, this->input.data(), this->resampled.data(), numOut);
+        this->input.erase(this->input.begin(), this->input.begin() + jmin(used, static_cast<int>(this->input.size())));
+
+        this->audio.insert(this->audio.end(), this->resampled.begin(), this->resampled.end());
+        this->audioEnd += numOut;
+        this->arrivals.emplace_back(this->audioEnd, Time::getMillisecondCounterHiRes());
+    }
+    this->notify();
+}
+
+auto StreamingChopper::finish() -> int {
+    this->stopThread(-1);
+    if (!this->finished) {
+        this->analyse(true);
+        this->finished = true;
+    }
+    return this->getNumChops();
+}
+
+auto StreamingChopper::run() -> void {
+    while (!this->threadShouldExit()) {
+        this->analyse(false);
+        this->wait(50);
+    }
+}
+
+auto StreamingChopper::analyse(bool flush) -> void {
+    std::array<float, Crepe::frameSize> frame = {};
+
+    while (flush || !this->threadShouldExit()) {
+        {
+            const ScopedLock sl{this->lock};
+            auto center = this->nextFrame * this->analysisHop;
+            if (!flush && center + Crepe::frameSize / 2 > this->audioEnd) break;
+            if (flush && center >= this->audioEnd) break;
+
+            for (int i = 0; i < Crepe::frameSize; i++) {
+                auto index = center - Crepe::frameSize / 2 + i;
+                frame[static_cast<size_t>(i)] = index >= this->audioStart && index < this->audioEnd 
+                    ? this->audio[static_cast<size_t>(index - this->audioStart)] : 0.0f;
+            }
+        }
+
+        auto confidence = this->model->confidence(frame.data(), this->context);
+        auto f = this->nextFrame++;
+
+        if (confidence > this->options.threshold) {
+            if (this->regionStart < 0) {
+                this->regionStart = f;
+            } else if (f - this->regionEnd > this->maxGap) {
+                this->closeRegion();
+                this->regionStart = f;
+            }
+            this->regionEnd = f;
+        } else if (this->regionStart >= 0 && f - this->regionEnd > this->maxGap) {
+            this->closeRegion();
+        }
+
+        const ScopedLock sl{this->lock};
+        auto keepFrom = this->regionStart >= 0 ? this->regionStart * this->analysisHop 
+            : this->nextFrame * this->analysisHop - Crepe::frameSize / 2;
+        auto discard = keepFrom - this->audioStart;
+        if (discard > Crepe::sampleRate && discard * 2 > static_cast<int64>(this->audio.size())) {
+            this->audio.erase(this->audio.begin(), this->audio.begin() + static_cast<std::ptrdiff_t>(discard));
+            this->audioStart = keepFrom;
+            while (this->arrivals.size() > 1 && this->arrivals.front().first < this->audioStart) this->arrivals.pop_front();
+        }
+    }
+    if (flush && this->regionStart >= 0) this->closeRegion();
+}
+
+auto StreamingChopper::closeRegion() -> void {
+    std::vector<float> samples;
+    auto end = this->regionEnd * this->analysisHop;
+    {
+        const ScopedLock sl{this->lock};
+        auto start = jlimit(this->audioStart, this->audioEnd, this->regionStart * this->analysisHop);
+        auto clampedEnd = jlimit(start, this->audioEnd, end);
+        samples.assign(this->audio.begin() + static_cast<std::ptrdiff_t>(start - this->audioStart),
+            this->audio.begin() + static_cast<std::ptrdiff_t>(clampedEnd - this->audioStart));
+    }
+    auto index = this->regionIndex++;
+    this->regionStart = -1;
+    this->regionEnd = -1;
+
+    if (!Chopper::exportChop(samples.data(), static_cast<int>(samples.size()), Crepe::sampleRate, this->outputFolder, index, this->options)) return;
+    this->numChops++;
+
+    Chop chop;
+    chop.file = this->outputFolder.getChildFile("chop" + String{index} + ".wav");
+    chop.index = index;
+    chop.latencyMs = Time::getMillisecondCounterHiRes() - this->getArrivalTime(end);
+    if (this->onChop) this->onChop(chop);
+}
+
+auto StreamingChopper::getArrivalTime(int64 sample) const -> double {
+    const ScopedLock sl{this->lock};
+    for (auto& [end, time] : this->arrivals) {
+        if (end >= sample) return time;
+    }
+    return Time::getMillisecondCounterHiRes();
+}
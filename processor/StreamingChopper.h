@@ -0,0 +1,59 @@
+#pragma once
+#include <JuceHeader.h>
+#include "Crepe.h"
+#include "Chopper.h"
+
+class StreamingChopper : private Thread {
+public:
+    static constexpr int maxAnalysisStride = 4;
+
+    struct Chop {
+        File file;
+        int index = 0;
+        double latencyMs = 0.0;
+    };
+
+    StreamingChopper(std::shared_ptr<Crepe> model, const File& outputFolder, double sourceRate,
+        const Chopper::Options& options, std::function<void(const Chop&)> onChop = nullptr);
+    ~StreamingChopper() override;
+
+    auto append(const float* const* channels, int numChannels, int numSamples) -> void;
+    auto finish() -> int;
+    auto getNumChops() const -> int { return this->numChops.load(); }
+    auto getAnalysisHop() const -> int { return this->analysisHop; }
+
+    static auto getAnalysisStride(int gapFrames) -> int;
+
+private:
+    auto run() -> void override;
+    auto analyse(bool flush) -> void;
+    auto closeRegion() -> void;
+    auto getArrivalTime(int64 sample) const -> double;
+
+    std::shared_ptr<Crepe> model;
+    Crepe::Context context;
+    File outputFolder;
+    double sourceRate = 44100.0;
+    Chopper::Options options;
+    std::function<void(const Chop&)> onChop;
+    int analysisHop = Crepe::hopSize * maxAnalysisStride;
+    int maxGap = 1;
+
+    CriticalSection lock;
+    LagrangeInterpolator interpolator;
+    std::vector<float> input;
+    std::vector<float> resampled;
+    std::vector<float> audio;
+    int64 audioStart = 0;
+    int64 audioEnd = 0;
+    std::deque<std::pair<int64, double>> arrivals;
+
+    int64 nextFrame = 0;
+    int64 regionStart = -1;
+    int64 regionEnd = -1;
+    int regionIndex = 0;
+    std::atomic<int> numChops{0};
+    bool finished = false;
+
+    JUCE_DECLARE_NON_COPYABLE(StreamingChopper)
+};
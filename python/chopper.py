@@ -1,41 +1,211 @@
 import sys
+import time
 import subprocess
-import importlib.metadata
 
-required = {"demucs", "crepe", "librosa", "soundfile", "tensorflow", "onnxruntime"}
-installed = {dist.metadata["Name"].lower() for dist in importlib.metadata.distributions()}
-missing = required - installed
+started = time.perf_counter()
+required = ["demucs", "crepe", "librosa", "soundfile", "tensorflow", "onnxruntime"]
 
-if missing:
-    python = sys.executable
-    subprocess.check_call([python, "-m", "pip", "install", *missing], stdout=subprocess.DEVNULL)
+def provision():
+    import json
+    import importlib.metadata
+    installed = {dist.metadata["Name"].lower() for dist in importlib.metadata.distributions()}
+    missing = [name for name in required if name not in installed]
+    send = lambda message: print(json.dumps(message), flush=True)
+
+    for i, name in enumerate(missing):
+        send({"type": "progress", "stage": name, "fraction": i / len(missing), "eta": -1.0, "frames": i, "total": len(missing)})
+        try:
+            subprocess.check_call([sys.executable, "-m", "pip", "install", name], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        except subprocess.CalledProcessError:
+            send({"type": "error", "message": f"Failed to install {name}"})
+            return 1
+    # The embedded interpreter is configured from these, read them from a fresh process so new site folders are included.
+    query = "import json, sys; print(json.dumps({'home': sys.base_prefix, 'executable': sys.executable, 'paths': [p for p in sys.path if p], 'python_version': f'{sys.version_info[0]}.{sys.version_info[1]}'}))"
+    interpreter = json.loads(subprocess.check_output([sys.executable, "-c", query]))
+    send({"type": "result", **interpreter})
+    return 0
+
+if __name__ == "__main__" and "--provision" in sys.argv:
+    sys.exit(provision())
 
 import argparse
-import crepe
 import librosa
 import soundfile
 import os
+import re
+import json
+import struct
+import socket
+import numpy
 import shutil
+import threading
+import contextlib
+import concurrent.futures
+import torch
+import demucs.apply
+import demucs.audio
+import demucs.pretrained
 import demucs.separate
 
-def separate_vocals(input: str, output: str="vocals.wav"):
-    output_dir = os.path.dirname(output)
-    demucs.separate.main(["--two-stems=vocals", "-o", output_dir, input])
+imported = time.perf_counter()
+
+models = {}
+progress_handler = None
+progress_starts = {}
+trace_events = None
+startup_spans = [("imports", started, imported)]
+
+def trace_event(name: str, category: str, start: float, end: float):
+    if trace_events is not None:
+        trace_events.append({"name": name, "cat": category, "ph": "X", "ts": start * 1e6, "dur": (end - start) * 1e6, "tid": threading.get_native_id()})
+
+@contextlib.contextmanager
+def trace_span(name: str, category: str="chopper"):
+    start = time.perf_counter()
+    try:
+        yield
+    finally:
+        trace_event(name, category, start, time.perf_counter())
+
+def report_progress(stage: str, done: int, total: int):
+    now = time.monotonic()
+    if done == 0:
+        progress_starts[stage] = now
+    start = progress_starts.setdefault(stage, now)
+    elapsed = now - start
+    throughput = done / elapsed if elapsed > 0 else 0.0
+    eta = (total - done) / throughput if throughput > 0 else -1.0
+    progress = {"stage": stage, "fraction": done / total if total else 0.0, "eta": eta, "frames": done, "total": total, "throughput": throughput}
+    if done >= total:
+        progress_starts.pop(stage, None)
+    if progress_handler:
+        progress_handler(progress)
+
+def set_progress_handler(handler):
+    global progress_handler
+    progress_handler = handler
+
+class ProgressIterator:
+    def __init__(self, stage: str):
+        self.stage = stage
+
+    def tqdm(self, iterable, **kwargs):
+        items = list(iterable)
+        report_progress(self.stage, 0, len(items))
+        for i, item in enumerate(items):
+            yield item
+            report_progress(self.stage, i + 1, len(items))
+
+demucs.apply.tqdm = ProgressIterator("separating")
+
+def get_model(name: str="htdemucs"):
+    if name not in models:
+        with trace_span("demucs.model_load"):
+            model = demucs.pretrained.get_model(name)
+        model.eval()
+        models[name] = model
+    return models[name]
+
+def separate_wav(model, wav):
+    device = "cuda" if torch.cuda.is_available() else "cpu"
+    ref = wav.mean(0)
+    wav = (wav - ref.mean()) / ref.std()
 
-    demucs_folder = os.path.join(output_dir, "htdemucs")
-    dest_folder = os.listdir(demucs_folder)[0]
-    vocal_path = os.path.join(demucs_folder, dest_folder, "vocals.wav")
+    with trace_span("demucs.inference"), torch.no_grad():
+        sources = demucs.apply.apply_model(model, wav[None], device=device, split=True, overlap=0.25, progress=True)[0]
+    sources = sources * ref.std() + ref.mean()
+    return sources[model.sources.index("vocals")]
+
+def separate_vocals(input: str, output: str="vocals.wav", model_name: str="htdemucs"):
+    model = get_model(model_name)
+    with trace_span("demucs.load_track"):
+        wav = demucs.separate.load_track(input, model.audio_channels, model.samplerate)
+    vocals = separate_wav(model, wav)
 
     if (os.path.exists(output)):
         os.remove(output)
 
-    os.rename(vocal_path, output)
-    shutil.rmtree(demucs_folder)
+    with trace_span("demucs.write"):
+        demucs.audio.save_audio(vocals, output, samplerate=model.samplerate)
     return output
 
-def chop_vocals(input: str, output: str="chops", name: str="", threshold: float=0.5, min_duration: float=0.2, min_rms: float=0.01):
-    audio, sr = librosa.load(input, sr=16000)
-    time, freq, conf, act = crepe.predict(audio, sr, viterbi=True)
+def separate_embedded(channels: tuple, samplerate: float, model_name: str, progress):
+    set_progress_handler(lambda values: progress(json.dumps(values)))
+    try:
+        model = get_model(model_name)
+        audio = numpy.stack([numpy.frombuffer(channel, dtype=numpy.float32) for channel in channels])
+        wav = demucs.audio.convert_audio(torch.from_numpy(audio), int(samplerate), model.samplerate, model.audio_channels)
+        vocals = separate_wav(model, wav)
+        vocals = demucs.audio.convert_audio(vocals.cpu(), model.samplerate, int(samplerate), len(channels))
+        return numpy.ascontiguousarray(vocals.numpy(), dtype=numpy.float32)
+    finally:
+        set_progress_handler(None)
+
+def export_crepe(output: str, capacity: str="full", precision: str="f2"):
+    import crepe.core
+    model = crepe.core.build_and_load_model(capacity)
+    os.makedirs(os.path.dirname(os.path.abspath(output)), exist_ok=True)
+    dtype = "<f4" if precision == "f4" else "<f2"
+
+    with open(output + ".part", "wb") as file:
+        file.write(b"CREP")
+        file.write(struct.pack("<ii", 2 if dtype == "<f4" else 1, 6))
+        for l in range(1, 7):
+            conv = model.get_layer(f"conv{l}")
+            norm = model.get_layer(f"conv{l}-BN")
+            kernel, bias = conv.get_weights()
+            gamma, beta, mean, variance = norm.get_weights()
+            scale = gamma / numpy.sqrt(variance + norm.epsilon)
+            shift = beta - mean * scale
+
+            weights = kernel[:, 0, :, :].transpose(2, 1, 0)
+            file.write(struct.pack("<iiii", weights.shape[0], weights.shape[1], weights.shape[2], conv.strides[0]))
+            file.write(weights.astype(dtype).tobytes())
+            for values in (bias, scale, shift):
+                file.write(values.astype("<f4").tobytes())
+
+        kernel, bias = model.get_layer("classifier").get_weights()
+        file.write(struct.pack("<ii", kernel.shape[1], kernel.shape[0]))
+        file.write(kernel.T.astype(dtype).tobytes())
+        file.write(bias.astype("<f4").tobytes())
+
+    os.replace(output + ".part", output)
+    return output
+
+def get_crepe(capacity: str="full"):
+    import crepe.core
+    import tensorflow
+    model = crepe.core.build_and_load_model(capacity)
+    if not getattr(model, "reports_progress", False):
+        class PitchProgress(tensorflow.keras.callbacks.Callback):
+            def on_predict_batch_end(self, batch, logs=None):
+                report_progress("chopping", batch + 1, self.params.get("steps") or batch + 1)
+
+        predict = model.predict
+        model.predict = lambda *args, **kwargs: predict(*args, callbacks=[PitchProgress()], **kwargs)
+        model.reports_progress = True
+    return model
+
+def load_frames(path: str):
+    with open(path, "rb") as file:
+        magic, version, count = struct.unpack("<4sii", file.read(12))
+        if magic != b"VCPF" or version != 1:
+            raise ValueError(f"Invalid frames file {path}")
+        data = numpy.frombuffer(file.read(count * 12), dtype="<f4").reshape(3, count)
+    return data[0], data[1], data[2]
+
+def chop_vocals(input: str, output: str="chops", name: str="", threshold: float=0.5, min_duration: float=0.2, min_rms: float=0.01, frames: str=None, threads: int=0, folder: str=None):
+    with trace_span("audio.load"):
+        audio, sr = librosa.load(input, sr=16000)
+    if frames:
+        with trace_span("frames.load"):
+            time, freq, conf = load_frames(frames)
+    else:
+        import crepe
+        with trace_span("crepe.model_load"):
+            get_crepe()
+        with trace_span("crepe.predict"):
+            time, freq, conf, act = crepe.predict(audio, sr, viterbi=True, verbose=0)
 
     voiced = [i for i, c in enumerate(conf) if c > threshold]
     to_samples = lambda frame: int(frame * 0.01 * sr)
@@ -52,26 +222,134 @@ def chop_vocals(input: str, output: str="chops", name: str="", threshold: float=
         regions.append((to_samples(start), to_samples(end)))
 
     output_basename = os.path.splitext(os.path.basename(name if name else input))[0]
-    output_dir = os.path.join(output, f"{output_basename} chops")
+    output_dir = folder if folder else os.path.join(output, f"{output_basename} chops")
 
     if os.path.exists(output_dir):
         shutil.rmtree(output_dir)
 
     os.makedirs(output_dir, exist_ok=True)
-    for i, (start, end) in enumerate(regions):
+    info = soundfile.info(input)
+    ratio = info.samplerate / sr
+    subtype = info.subtype if info.subtype in ("PCM_16", "PCM_24") else "PCM_24"
+
+    local = threading.local()
+
+    def export_chop(i: int, start: int, end: int):
+        with trace_span(f"chop{i}", "export"):
+            return write_chop(i, start, end)
+
+    def write_chop(i: int, start: int, end: int):
         chop = audio[start:end]
 
         if len(chop) < int(min_duration * sr):
-            continue
+            return False
 
         rms = librosa.feature.rms(y=chop).mean()
         if rms < min_rms:
-            continue
+            return False
+
+        _, (trim_start, trim_end) = librosa.effects.trim(chop)
+        source_start = round((start + trim_start) * ratio)
+        source_end = min(info.frames, round((start + trim_end) * ratio))
+
+        if not hasattr(local, "source"):
+            local.source = soundfile.SoundFile(input)
+        local.source.seek(source_start)
+        data = local.source.read(source_end - source_start, always_2d=True)
+
+        soundfile.write(os.path.join(output_dir, f"chop{i}.wav"), data, info.samplerate, subtype=subtype)
+        return True
+
+    workers = threads if threads > 0 else os.cpu_count() or 1
+    written = 0
+    with trace_span("chops.write"), concurrent.futures.ThreadPoolExecutor(max_workers=workers) as executor:
+        pending = set()
+        for i, (start, end) in enumerate(regions):
+            if len(pending) >= workers * 2:
+                done, pending = concurrent.futures.wait(pending, return_when=concurrent.futures.FIRST_COMPLETED)
+                written += sum(1 for future in done if future.result())
+            pending.add(executor.submit(export_chop, i, start, end))
+        written += sum(1 for future in concurrent.futures.as_completed(pending) if future.result())
+    return {"folder": output_dir, "chops": written}
+
+def send_message(connection: socket.socket, message: dict):
+    connection.sendall((json.dumps(message) + "\n").encode("utf-8"))
+
+class OutputWriter:
+    def __init__(self, connection: socket.socket):
+        self.connection = connection
+        self.buffer = ""
 
-        trim, _ = librosa.effects.trim(chop)
+    def write(self, text: str):
+        *lines, self.buffer = re.split(r"[\r\n]", self.buffer + text)
+        for line in lines:
+            if line.strip():
+                send_message(self.connection, {"type": "output", "text": line})
+        return len(text)
 
-        soundfile.write(os.path.join(output_dir, f"chop{i}.wav"), trim, sr)
-    return output_dir
+    def flush(self):
+        pass
+
+    def isatty(self):
+        return False
+
+def run_request(request: dict):
+    command = request.get("command")
+    with trace_span(command, "request"):
+        return run_command(command, request)
+
+def run_command(command: str, request: dict):
+    if command == "separate":
+        return separate_vocals(request["input"], request["output"], request.get("model", "htdemucs"))
+    elif command == "chop":
+        return chop_vocals(request["input"], request["output"], request.get("name", ""), request.get("threshold", 0.5),
+                           request.get("min_duration", 0.2), request.get("min_rms", 0.01), request.get("frames"), request.get("threads", 0), request.get("folder"))
+    elif command == "export_crepe":
+        return export_crepe(request["output"], request.get("capacity", "full"), request.get("precision", "f2"))
+    raise ValueError(f"Unknown command {command}")
+
+def begin_trace(enabled: bool):
+    global trace_events, startup_spans
+    if not enabled:
+        return None
+    trace_events = []
+    for name, start, end in startup_spans:
+        trace_event(name, "startup", start, end)
+    startup_spans = []
+    return time.perf_counter() * 1e6
+
+def end_trace(clock: float):
+    global trace_events
+    events, trace_events = trace_events, None
+    return {"trace": events, "trace_clock": clock} if clock is not None else {}
+
+def handle_request(request: dict):
+    trace = begin_trace(request.get("trace", False))
+    try:
+        output = run_request(request)
+        return {"type": "result", "id": request.get("id"), "output": output, **end_trace(trace)}
+    except Exception as e:
+        return {"type": "error", "id": request.get("id"), "message": str(e), **end_trace(trace)}
+
+def run_embedded(request: str, progress):
+    set_progress_handler(lambda values: progress(json.dumps(values)))
+    try:
+        return json.dumps(handle_request(json.loads(request)))
+    finally:
+        set_progress_handler(None)
+
+def serve(port: int, token: str):
+    connection = socket.create_connection(("127.0.0.1", port))
+    connection.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+    send_message(connection, {"type": "hello", "token": token})
+    sys.stdout = sys.stderr = OutputWriter(connection)
+
+    for line in connection.makefile("r", encoding="utf-8"):
+        if not line.strip():
+            continue
+        request = json.loads(line)
+        set_progress_handler(lambda progress, id=request.get("id"): send_message(connection, {"type": "progress", "id": id, **progress}))
+        send_message(connection, handle_request(request))
 
 if __name__ == "__main__":
     parser = argparse.ArgumentParser(description="Vocal Chopper")
@@ -79,20 +357,34 @@ if __name__ == "__main__":
     group = parser.add_mutually_exclusive_group(required=True)
     group.add_argument("--separate", action="store_true")
     group.add_argument("--chop", action="store_true")
+    group.add_argument("--worker", action="store_true")
+    group.add_argument("--export-crepe", action="store_true")
+    group.add_argument("--provision", metavar="PROGRESS_FILE")
 
     parser.add_argument("-i", "--input")
     parser.add_argument("-o", "--output")
     parser.add_argument("-n", "--name")
+    parser.add_argument("--port", type=int)
+    parser.add_argument("--token", default="")
+    parser.add_argument("--frames")
+    parser.add_argument("--capacity", default="full")
+    parser.add_argument("--threads", type=int, default=0)
 
     parser.add_argument("--threshold", type=float, default=0.5)
     parser.add_argument("--min-duration", type=float, default=0.2)
     parser.add_argument("--min-rms", type=float, default=0.01)
 
     args = parser.parse_args()
+    set_progress_handler(lambda progress: print(f"{progress['stage']} {progress['frames']}/{progress['total']}", file=sys.stderr))
 
     if args.separate:
         output = separate_vocals(args.input, args.output)
         print(output)
     elif args.chop:
-        output = chop_vocals(args.input, args.output, args.name, args.threshold, args.min_duration, args.min_rms)
-        print(output)
\ No newline at end of file
+        output = chop_vocals(args.input, args.output, args.name, args.threshold, args.min_duration, args.min_rms, args.frames, args.threads)
+        print(f"{output['chops']} chops written to {output['folder']}")
+    elif args.export_crepe:
+        output = export_crepe(args.output, args.capacity)
+        print(output)
+    elif args.worker:
+        serve(args.port, args.token)
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+#include <JuceHeader.h>
+
+class ContentHash {
+public:
+    auto update(const void* data, size_t size) -> void {
+        auto* bytes = static_cast<const uint8*>(data);
+        for (size_t i = 0; i < size; i++) {
+            this->state = (this->state ^ bytes[i]) * 0x100000001b3ULL;
+        }
+    }
+
+    auto toString() const -> String {
+        return String::toHexString(static_cast<int64>(this->state)).paddedLeft('0', 16);
+    }
+
+    static auto ofStream(InputStream& stream) -> String {
+        ContentHash hash;
+        HeapBlock<char> buffer{1 << 16};
+        while (!stream.isExhausted()) {
+            auto read = stream.read(buffer, 1 << 16);
+            if (read <= 0) break;
+            hash.update(buffer, static_cast<size_t>(read));
+        }
+        return hash.toString();
+    }
+
+    static auto ofFile(const File& file) -> String {
+        FileInputStream stream{file};
+        if (!stream.openedOk()) return "";
+        return ofStream(stream);
+    }
+
+private:
+    uint64 state = 0xcbf29ce484222325ULL;
+};
@@ -0,0 +1,40 @@
+#pragma once
+#include <JuceHeader.h>
+
+class LineBuffer {
+public:
+    auto append(const char* data, size_t size) -> void {
+        if (this->start > 0 && this->start * 2 >= this->pending.size()) {
+            this->pending.erase(0, this->start);
+            this->searchFrom -= this->start;
+            this->start = 0;
+        }
+        this->pending.append(data, size);
+    }
+
+    auto next(String& line) -> bool {
+        auto newline = this->pending.find('\n', this->searchFrom);
+        if (newline == std::string::npos) {
+            this->searchFrom = this->pending.size();
+            return false;
+        }
+        auto end = newline > this->start && this->pending[newline - 1] == '\r' ? newline - 1 : newline;
+        line = String::fromUTF8(this->pending.data() + this->start, static_cast<int>(end - this->start));
+        this->start = newline + 1;
+        this->searchFrom = this->start;
+
+        if (this->start == this->pending.size()) this->clear();
+        return true;
+    }
+
+    auto clear() -> void {
+        this->pending.clear();
+        this->start = 0;
+        this->searchFrom = 0;
+    }
+
+private:
+    std::string pending = "";
+    size_t start = 0;
+    size_t searchFrom = 0;
+};
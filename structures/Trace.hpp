@@ -0,0 +1,91 @@
+#pragma once
+#include <JuceHeader.h>
+
+class Trace {
+public:
+    static constexpr int nativeProcess = 1;
+    static constexpr int pythonProcess = 2;
+
+    class Span {
+    public:
+        Span(Trace* trace, const String& name, const String& category = "job")
+            : trace(trace), name(name), category(category), start(trace != nullptr ? trace->now() : 0.0) {}
+
+        ~Span() {
+            if (this->trace != nullptr) this->trace->complete(this->name, this->category, this->start, this->trace->now() - this->start);
+        }
+
+    private:
+        Trace* trace = nullptr;
+        String name = "";
+        String category = "";
+        double start = 0.0;
+
+        JUCE_DECLARE_NON_COPYABLE(Span)
+    };
+
+    Trace() : origin(Time::getHighResolutionTicks()) {
+        this->addProcessName(nativeProcess, JucePlugin_Name);
+        this->addProcessName(pythonProcess, "chopper.py");
+    }
+
+    auto now() const -> double {
+        return Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - this->origin) * 1.0e6;
+    }
+
+    auto complete(const String& name, const String& category, double start, double duration) -> void {
+        auto* event = new DynamicObject();
+        event->setProperty("name", name);
+        event->setProperty("cat", category);
+        event->setProperty("ph", "X");
+        event->setProperty("ts", start);
+        event->setProperty("dur", duration);
+        event->setProperty("pid", nativeProcess);
+        event->setProperty("tid", static_cast<int64>(reinterpret_cast<pointer_sized_int>(Thread::getCurrentThreadId())));
+        this->add(var{event});
+    }
+
+    auto merge(const var& events, double offset) -> void {
+        if (!events.isArray()) return;
+        for (auto& event : *events.getArray()) {
+            auto* obj = event.getDynamicObject();
+            if (obj == nullptr) continue;
+            obj->setProperty("ts", static_cast<double>(obj->getProperty("ts")) + offset);
+            obj->setProperty("pid", pythonProcess);
+            this->add(event);
+        }
+    }
+
+    auto write(const File& file) const -> bool {
+        auto* obj = new DynamicObject();
+        {
+            const ScopedLock sl{this->lock};
+            obj->setProperty("traceEvents", this->events);
+        }
+        obj->setProperty("displayTimeUnit", "ms");
+        return file.replaceWithText(JSON::toString(var{obj}, true));
+    }
+
+private:
+    auto add(const var& event) -> void {
+        const ScopedLock sl{this->lock};
+        this->events.add(event);
+    }
+
+    auto addProcessName(int pid, const String& name) -> void {
+        auto* args = new DynamicObject();
+        args->setProperty("name", name);
+        auto* event = new DynamicObject();
+        event->setProperty("name", "process_name");
+        event->setProperty("ph", "M");
+        event->setProperty("pid", pid);
+        event->setProperty("args", var{args});
+        this->add(var{event});
+    }
+
+    int64 origin = 0;
+    mutable CriticalSection lock;
+    Array<var> events;
+
+    JUCE_DECLARE_NON_COPYABLE(Trace)
+};
@@ -0,0 +1,164 @@
+#include <JuceHeader.h>
+#include "CaptureRecorder.h"
+
+#if JUCE_LINUX && defined(__GLIBC__)
+  #include <dlfcn.h>
+  #include <pthread.h>
+  #define VOCAL_CHOPPER_LOCK_HOOKS 1
+#else
+  #define VOCAL_CHOPPER_LOCK_HOOKS 0
+#endif
+
+// Counts heap and lock calls made by the current thread while armed.
+namespace RealtimeHooks {
+    static thread_local bool armed = false;
+    static std::atomic<int> allocations{0};
+    static std::atomic<int> locks{0};
+
+    static auto hit(std::atomic<int>& counter) -> void {
+        if (armed) counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    struct Armed {
+        Armed() {
+            allocations = 0;
+            locks = 0;
+            armed = true;
+        }
+        ~Armed() { armed = false; }
+    };
+}
+
+#if VOCAL_CHOPPER_LOCK_HOOKS
+template <typename Function>
+static auto findNext(std::atomic<Function>& cached, const char* name) -> Function {
+    auto function = cached.load(std::memory_order_acquire);
+    if (function != nullptr) return function;
+    function = reinterpret_cast<Function>(dlsym(RTLD_NEXT, name));
+    cached.store(function, std::memory_order_release);
+    return function;
+}
+
+using MutexFunction = int (*)(pthread_mutex_t*);
+using RwLockFunction = int (*)(pthread_rwlock_t*);
+static std::atomic<MutexFunction> nextMutexLock{nullptr};
+static std::atomic<MutexFunction> nextMutexTryLock{nullptr};
+static std::atomic<RwLockFunction> nextReadLock{nullptr};
+static std::atomic<RwLockFunction> nextWriteLock{nullptr};
+
+extern "C" {
+    auto __libc_malloc(size_t size) -> void*;
+    auto __libc_calloc(size_t count, size_t size) -> void*;
+    auto __libc_realloc(void* pointer, size_t size) -> void*;
+    auto __libc_free(void* pointer) -> void;
+
+    auto malloc(size_t size) noexcept -> void* {
+        RealtimeHooks::hit(RealtimeHooks::allocations);
+        return __libc_malloc(size);
+    }
+    auto calloc(size_t count, size_t size) noexcept -> void* {
+        RealtimeHooks::hit(RealtimeHooks::allocations);
+        return __libc_calloc(count, size);
+    }
+    auto realloc(void* pointer, size_t size) noexcept -> void* {
+        RealtimeHooks::hit(RealtimeHooks::allocations);
+        return __libc_realloc(pointer, size);
+    }
+    auto free(void* pointer) noexcept -> void {
+        RealtimeHooks::hit(RealtimeHooks::allocations);
+        __libc_free(pointer);
+    }
+
+    auto pthread_mutex_lock(pthread_mutex_t* mutex) noexcept -> int {
+        RealtimeHooks::hit(RealtimeHooks::locks);
+        return findNext(nextMutexLock, "pthread_mutex_lock")(mutex);
+    }
+    auto pthread_mutex_trylock(pthread_mutex_t* mutex) noexcept -> int {
+        RealtimeHooks::hit(RealtimeHooks::locks);
+        return findNext(nextMutexTryLock, "pthread_mutex_trylock")(mutex);
+    }
+    auto pthread_rwlock_rdlock(pthread_rwlock_t* rwlock) noexcept -> int {
+        RealtimeHooks::hit(RealtimeHooks::locks);
+        return findNext(nextReadLock, "pthread_rwlock_rdlock")(rwlock);
+    }
+    auto pthread_rwlock_wrlock(pthread_rwlock_t* rwlock) noexcept -> int {
+        RealtimeHooks::hit(RealtimeHooks::locks);
+        return findNext(nextWriteLock, "pthread_rwlock_wrlock")(rwlock);
+    }
+}
+#endif
+
+auto operator new(std::size_t size) -> void* {
+    RealtimeHooks::hit(RealtimeHooks::allocations);
+    if (auto* pointer = std::malloc(size == 0 ? 1 : size)) return pointer;
+    throw std::bad_alloc{};
+}
+auto operator new[](std::size_t size) -> void* { return operator new(size); }
+auto operator delete(void* pointer) noexcept -> void {
+    RealtimeHooks::hit(RealtimeHooks::allocations);
+    std::free(pointer);
+}
+auto operator delete[](void* pointer) noexcept -> void { operator delete(pointer); }
+auto operator delete(void* pointer, std::size_t) noexcept -> void { operator delete(pointer); }
+auto operator delete[](void* pointer, std::size_t) noexcept -> void { operator delete(pointer); }
+
+class CaptureRecorderTests : public UnitTest {
+public:
+    static constexpr double sampleRate = 48000.0;
+    static constexpr int blockSize = 512;
+    static constexpr int numBlocks = 200;
+    static constexpr int largeBlockSize = 65536;
+
+    CaptureRecorderTests() : UnitTest("CaptureRecorder", "processor") {}
+
+    auto runTest() -> void override {
+        #if !VOCAL_CHOPPER_LOCK_HOOKS
+            logMessage("Lock hooks are only available on glibc, checking operator new and delete only");
+        #endif
+        AudioBuffer<float> block{2, blockSize};
+        for (int i = 0; i < blockSize; i++) {
+            auto sample = static_cast<float>(std::sin(MathConstants<double>::twoPi * 440.0 * i / sampleRate)) * 0.5f;
+            block.setSample(0, i, sample);
+            block.setSample(1, i, -sample);
+        }
+
+        beginTest("push does not allocate or lock while idle");
+        CaptureRecorder capture;
+        capture.prepare(sampleRate, blockSize, 2);
+        expectEquals(this->pushArmed(capture, block), 0);
+
+        beginTest("push does not allocate or lock while recording");
+        TemporaryFile take{".wav"};
+        std::atomic<int64> received{0};
+        expect(capture.start(take.getFile(), [&](auto, int, int numSamples) { received += numSamples; }));
+        int hits = 0;
+        for (int i = 0; i < numBlocks; i++) {
+            hits += this->pushArmed(capture, block);
+            if (i % 16 == 0) Thread::sleep(1);
+        }
+        expectEquals(hits, 0);
+
+        beginTest("prepare keeps a take with the same format");
+        capture.prepare(sampleRate, largeBlockSize, 2);
+        expect(capture.isRecording(), "prepare stopped the take");
+        for (int i = 0; i < numBlocks; i++) hits += this->pushArmed(capture, block);
+        expectEquals(hits, 0);
+        expect(!capture.canContinue(sampleRate / 2, 2), "a sample rate change continued the take");
+        expect(!capture.canContinue(sampleRate, 1), "a channel change continued the take");
+
+        auto file = capture.stop();
+        expect(file == take.getFile());
+        expectEquals(capture.getDroppedSamples(), static_cast<int64>(0));
+        expectEquals(capture.getRecordedSamples(), static_cast<int64>(numBlocks * 2 * blockSize));
+        expectEquals(received.load(), capture.getRecordedSamples());
+    }
+
+private:
+    auto pushArmed(CaptureRecorder& capture, const AudioBuffer<float>& block) -> int {
+        RealtimeHooks::Armed armed;
+        capture.push(block);
+        return RealtimeHooks::allocations.load() + RealtimeHooks::locks.load();
+    }
+};
+
+static CaptureRecorderTests captureRecorderTests;
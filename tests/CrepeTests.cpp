@@ -0,0 +1,116 @@
+#include <JuceHeader.h>
+#include "Crepe.h"
+
+class CrepeTests : public UnitTest {
+public:
+    CrepeTests() : UnitTest("Crepe", "processor") {}
+
+    auto runTest() -> void override {
+        auto fixtures = File{VOCAL_CHOPPER_TEST_FIXTURES};
+        auto folder = fixtures.getChildFile("crepe");
+        auto modelFile = folder.getChildFile("model.bin");
+
+        beginTest("Native kernels match the numpy transcription");
+        this->expectParity(folder);
+
+        beginTest("Exported full model matches crepe.predict");
+        if (fixtures.getChildFile("crepe-full/reference.json").existsAsFile()) {
+            this->expectParity(fixtures.getChildFile("crepe-full"));
+        } else {
+            logMessage("No crepe-full fixture, generate it with generate.py --crepe full where crepe is installed");
+        }
+
+        beginTest("Streamed confidence matches predict");
+        if (auto model = Crepe::load(modelFile)) {
+            MemoryBlock audio;
+            folder.getChildFile("audio.f32").loadFileAsData(audio);
+            auto* samples = static_cast<const float*>(audio.getData());
+            auto numSamples = static_cast<int>(audio.getSize() / sizeof(float));
+            auto expected = model->predict(samples, numSamples, false);
+
+            for (auto blockSize : {1, 160, 1000, numSamples}) {
+                Crepe::ConfidenceStream stream{*model};
+                for (int position = 0; position < numSamples; position += blockSize) {
+                    stream.push(samples + position, jmin(blockSize, numSamples - position));
+                }
+                auto frames = stream.finish();
+                expectEquals(frames.size(), expected.size());
+                for (size_t f = 0; f < jmin(frames.conf.size(), expected.conf.size()); f++) {
+                    expectEquals(frames.conf[f], expected.conf[f], "block size " + String{blockSize} + " frame " + String{static_cast<int>(f)});
+                    expectEquals(frames.time[f], expected.time[f]);
+                }
+            }
+        }
+
+        beginTest("Corrupt models are rejected");
+        MemoryBlock bytes;
+        modelFile.loadFileAsData(bytes);
+        auto corrupt = [&](std::function<void(MemoryBlock&)> edit) {
+            TemporaryFile temp{".bin"};
+            auto copy = bytes;
+            edit(copy);
+            temp.getFile().replaceWithData(copy.getData(), copy.getSize());
+            return Crepe::load(temp.getFile()) == nullptr;
+        };
+        auto setInt = [](MemoryBlock& block, size_t offset, int value) {
+            auto little = ByteOrder::swapIfBigEndian(static_cast<uint32>(value));
+            block.copyFrom(&little, static_cast<int>(offset), sizeof(little));
+        };
+        static constexpr size_t firstLayer = 12;
+
+        expect(corrupt([&](MemoryBlock& block) { setInt(block, firstLayer + 8, 0); }), "zero width accepted");
+        expect(corrupt([&](MemoryBlock& block) { setInt(block, firstLayer + 12, 0); }), "zero stride accepted");
+        expect(corrupt([&](MemoryBlock& block) { setInt(block, firstLayer + 12, 3); }), "mismatched stride accepted");
+        expect(corrupt([&](MemoryBlock& block) { setInt(block, 8, 1000000); }), "layer count accepted");
+        expect(corrupt([&](MemoryBlock& block) { setInt(block, 4, 3); }), "unknown version accepted");
+        expect(corrupt([&](MemoryBlock& block) { block.setSize(block.getSize() / 2); }), "truncated model accepted");
+        expect(corrupt([&](MemoryBlock& block) { block.setSize(block.getSize() - 4); }), "truncated dense bias accepted");
+    }
+
+private:
+    auto expectParity(const File& folder) -> void {
+        auto model = Crepe::load(folder.getChildFile("model.bin"));
+        expect(model != nullptr, folder.getFileName() + " model failed to load");
+        if (model == nullptr) return;
+
+        auto reference = JSON::parse(folder.getChildFile("reference.json"));
+        auto confTolerance = static_cast<double>(reference["tolerance"]["confidence"]);
+        auto centsTolerance = static_cast<double>(reference["tolerance"]["cents"]);
+        logMessage("Reference: " + reference["reference"].toString());
+
+        MemoryBlock audio;
+        folder.getChildFile("audio.f32").loadFileAsData(audio);
+        auto frames = model->predict(static_cast<const float*>(audio.getData()), static_cast<int>(audio.getSize() / sizeof(float)));
+
+        auto* time = reference["time"].getArray();
+        auto* freq = reference["frequency"].getArray();
+        auto* conf = reference["confidence"].getArray();
+        expect(time != nullptr && freq != nullptr && conf != nullptr, "reference.json is missing frames");
+        if (time == nullptr || freq == nullptr || conf == nullptr) return;
+        expectEquals(frames.size(), conf->size());
+
+        auto worstConf = 0.0;
+        auto worstCents = 0.0;
+        for (int f = 0; f < jmin(frames.size(), conf->size()); f++) {
+            auto index = static_cast<size_t>(f);
+            expectWithinAbsoluteError(static_cast<double>(frames.time[index]), static_cast<double>((*time)[f]), 1e-6);
+
+            auto confError = std::abs(frames.conf[index] - static_cast<double>((*conf)[f]));
+            expect(confError <= confTolerance, "frame " + String{f} + " confidence differs by " + String{confError});
+            worstConf = jmax(worstConf, confError);
+
+            auto expected = static_cast<double>((*freq)[f]);
+            auto actual = static_cast<double>(frames.freq[index]);
+            if (expected <= 0.0 || actual <= 0.0) {
+                expect(expected <= 0.0 && actual <= 0.0, "frame " + String{f} + " voicing differs");
+                continue;
+            }
+            auto centsError = std::abs(1200.0 * std::log2(actual / expected));
+            expect(centsError <= centsTolerance, "frame " + String{f} + " pitch differs by " + String{centsError} + " cents");
+            worstCents = jmax(worstCents, centsError);
+        }
+        logMessage("Worst confidence error " + String{worstConf} + ", worst pitch error " + String{worstCents} + " cents");
+    }
+};
+
+static CrepeTests crepeTests;
@@ -0,0 +1,18 @@
+#include <JuceHeader.h>
+
+auto main(int argc, char* argv[]) -> int {
+    ArgumentList args{argc, argv};
+    UnitTestRunner runner;
+    runner.setAssertOnFailure(false);
+
+    auto category = args.getValueForOption("--category");
+    if (category.isNotEmpty()) {
+        runner.runTestsInCategory(category);
+    } else {
+        runner.runAllTests();
+    }
+
+    int failures = 0;
+    for (int i = 0; i < runner.getNumResults(); i++) failures += runner.getResult(i)->failures;
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,195 @@
+import os
+import sys
+import json
+import struct
+import argparse
+import numpy
+
+# Regenerates the native CREPE fixtures. With --crepe the reference is crepe.predict itself on the shipped weights,
+# written to ../crepe-full by default. Otherwise a numpy transcription of crepe.core runs a small seeded model with
+# the same layer layout, which checks the native kernels without the 40 MB full model.
+
+sample_rate = 16000
+hop_size = 160
+frame_size = 1024
+num_bins = 360
+widths = [512, 64, 64, 64, 64, 64]
+strides = [4, 1, 1, 1, 1, 1]
+cents_mapping = numpy.linspace(0, 7180, num_bins) + 1997.3794084376191
+
+def make_audio(seconds: float=1.0):
+    t = numpy.arange(int(seconds * sample_rate)) / sample_rate
+    freq = 220.0 * 2 ** (t / seconds) * (1 + 0.01 * numpy.sin(2 * numpy.pi * 5.5 * t))
+    phase = 2 * numpy.pi * numpy.cumsum(freq) / sample_rate
+    audio = sum(numpy.sin(h * phase) / h for h in range(1, 6)) * 0.3
+    audio += numpy.random.default_rng(7).normal(0, 0.01, len(t))
+    audio[int(0.45 * len(t)):int(0.55 * len(t))] = 0.0
+    return audio.astype(numpy.float32)
+
+def make_layers(multiplier: int, seed: int):
+    rng = numpy.random.default_rng(seed)
+    layers = []
+    channels = 1
+    for n, width, stride in zip([32, 4, 4, 4, 8, 16], widths, strides):
+        filters = n * multiplier
+        kernel = rng.normal(0, numpy.sqrt(2 / (channels * width)), (filters, channels, width)).astype(numpy.float16)
+        bias = rng.normal(0, 0.05, filters).astype(numpy.float32)
+        scale = rng.uniform(0.5, 1.5, filters).astype(numpy.float32)
+        shift = rng.normal(0, 0.1, filters).astype(numpy.float32)
+        layers.append((kernel, bias, scale, shift, stride))
+        channels = filters
+    length = frame_size
+    for stride in strides:
+        length = -(-length // stride) // 2
+    dense = rng.normal(0, 1.5 / numpy.sqrt(length * channels), (num_bins, length * channels)).astype(numpy.float16)
+    dense_bias = rng.normal(-1.0, 0.5, num_bins).astype(numpy.float32)
+    return layers, (dense, dense_bias)
+
+def cents_error(a, b):
+    voiced = (a > 0) & (b > 0)
+    return float(numpy.max(numpy.abs(1200 * numpy.log2(a[voiced] / b[voiced])), initial=0.0))
+
+# The reference is unmodified crepe.predict on the shipped weights. The model comes from the plugin's own exporter,
+# fp16 unless rounding the weights alone already moves the output past the tolerance.
+def crepe_fixture(capacity: str, audio, tolerance, output: str):
+    import crepe
+    import crepe.core
+    sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "..", "python"))
+    import chopper
+
+    time, frequency, confidence, activation = crepe.predict(audio, sample_rate, model_capacity=capacity, viterbi=True, step_size=10, verbose=0)
+
+    model = crepe.core.build_and_load_model(capacity)
+    original = [layer.get_weights() for layer in model.layers]
+    for layer in model.layers:
+        if layer.name.startswith("conv") and not layer.name.endswith("-BN") or layer.name == "classifier":
+            kernel, bias = layer.get_weights()
+            layer.set_weights([kernel.astype(numpy.float16).astype(numpy.float32), bias])
+    _, rounded_frequency, rounded_confidence, _ = crepe.predict(audio, sample_rate, model_capacity=capacity, viterbi=True, step_size=10, verbose=0)
+    for layer, weights in zip(model.layers, original):
+        layer.set_weights(weights)
+
+    conf_error = float(numpy.max(numpy.abs(rounded_confidence - confidence)))
+    pitch_error = cents_error(rounded_frequency, frequency)
+    precision = "f2" if conf_error < tolerance["confidence"] / 2 and pitch_error < tolerance["cents"] / 2 else "f4"
+    print(f"fp16 weights move confidence by {conf_error} and pitch by {pitch_error} cents, exporting {precision}", file=sys.stderr)
+    chopper.export_crepe(os.path.join(output, "model.bin"), capacity, precision)
+    return time, frequency, confidence, activation, f"crepe {crepe.version.version} ({capacity}, {precision} export)"
+
+def write_model(path: str, layers, dense):
+    with open(path, "wb") as file:
+        file.write(b"CREP")
+        file.write(struct.pack("<ii", 1, len(layers)))
+        for kernel, bias, scale, shift, stride in layers:
+            file.write(struct.pack("<iiii", kernel.shape[0], kernel.shape[1], kernel.shape[2], stride))
+            file.write(kernel.astype("<f2").tobytes())
+            for values in (bias, scale, shift):
+                file.write(numpy.asarray(values).astype("<f4").tobytes())
+        file.write(struct.pack("<ii", dense[0].shape[0], dense[0].shape[1]))
+        file.write(dense[0].astype("<f2").tobytes())
+        file.write(numpy.asarray(dense[1]).astype("<f4").tobytes())
+
+# crepe.core.get_activation with center=True and step_size=10
+def get_frames(audio):
+    audio = numpy.pad(audio.astype(numpy.float64), frame_size // 2, mode="constant")
+    n_frames = 1 + (len(audio) - frame_size) // hop_size
+    frames = numpy.lib.stride_tricks.as_strided(audio, shape=(n_frames, frame_size), strides=(audio.itemsize * hop_size, audio.itemsize)).copy()
+    frames -= numpy.mean(frames, axis=1)[:, numpy.newaxis]
+    frames /= numpy.clip(numpy.std(frames, axis=1)[:, numpy.newaxis], 1e-8, None)
+    return frames
+
+# Conv2D(padding="same", activation="relu") -> BatchNormalization -> MaxPool2D((2, 1))
+def conv_block(x, kernel, bias, scale, shift, stride):
+    channels, length = x.shape
+    filters, _, width = kernel.shape
+    out_length = -(-length // stride)
+    pad = max((out_length - 1) * stride + width - length, 0)
+    padded = numpy.pad(x, ((0, 0), (pad // 2, pad - pad // 2)))
+    windows = numpy.lib.stride_tricks.sliding_window_view(padded, width, axis=1)[:, ::stride][:, :out_length]
+    y = numpy.einsum("fck,ctk->ft", kernel.astype(numpy.float64), windows)
+    y = numpy.maximum(y + bias[:, numpy.newaxis], 0) * scale[:, numpy.newaxis] + shift[:, numpy.newaxis]
+    pooled = out_length // 2
+    return numpy.maximum(y[:, 0:2 * pooled:2], y[:, 1:2 * pooled:2])
+
+def get_activation(frames, layers, dense):
+    activation = numpy.zeros((len(frames), num_bins))
+    for i, frame in enumerate(frames):
+        x = frame[numpy.newaxis, :]
+        for kernel, bias, scale, shift, stride in layers:
+            x = conv_block(x, kernel, numpy.asarray(bias, numpy.float64), numpy.asarray(scale, numpy.float64), numpy.asarray(shift, numpy.float64), stride)
+        flat = x.T.reshape(-1)
+        activation[i] = 1 / (1 + numpy.exp(-(dense[0].astype(numpy.float64) @ flat + dense[1])))
+    return activation
+
+# crepe.core.to_local_average_cents
+def to_local_average_cents(salience, center):
+    start = max(0, center - 4)
+    end = min(len(salience), center + 5)
+    salience = salience[start:end]
+    return numpy.sum(salience * cents_mapping[start:end]) / numpy.sum(salience)
+
+# crepe.core.to_viterbi_cents, the MultinomialHMM decode written out
+def to_viterbi_cents(salience):
+    starting = numpy.ones(num_bins) / num_bins
+    xx, yy = numpy.meshgrid(range(num_bins), range(num_bins))
+    transition = numpy.maximum(12 - abs(xx - yy), 0)
+    transition = transition / numpy.sum(transition, axis=1)[:, None]
+    self_emission = 0.1
+    emission = numpy.eye(num_bins) * self_emission + numpy.ones((num_bins, num_bins)) * ((1 - self_emission) / num_bins)
+
+    with numpy.errstate(divide="ignore"):
+        log_transition = numpy.log(transition)
+    log_emission = numpy.log(emission)
+    observations = numpy.argmax(salience, axis=1)
+
+    delta = numpy.log(starting) + log_emission[:, observations[0]]
+    backtrack = numpy.zeros((len(observations), num_bins), dtype=int)
+    for t in range(1, len(observations)):
+        scores = delta[:, None] + log_transition
+        backtrack[t] = numpy.argmax(scores, axis=0)
+        delta = scores[backtrack[t], numpy.arange(num_bins)] + log_emission[:, observations[t]]
+
+    path = numpy.zeros(len(observations), dtype=int)
+    path[-1] = numpy.argmax(delta)
+    for t in range(len(observations) - 1, 0, -1):
+        path[t - 1] = backtrack[t, path[t]]
+    return numpy.array([to_local_average_cents(salience[i], path[i]) for i in range(len(observations))])
+
+def top_margin(activation):
+    ordered = numpy.sort(activation, axis=1)
+    return float(numpy.min(ordered[:, -1] - ordered[:, -2]))
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Generate the native CREPE parity fixture")
+    parser.add_argument("--crepe", metavar="CAPACITY", help="Use the crepe package with this model capacity")
+    parser.add_argument("--multiplier", type=int, default=1)
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--output")
+    args = parser.parse_args()
+    output = args.output or (os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "crepe-full") if args.crepe else ".")
+    os.makedirs(output, exist_ok=True)
+
+    audio = make_audio()
+    if args.crepe:
+        tolerance = {"confidence": 1e-3, "cents": 5.0}
+        time, frequency, confidence, activation, reference = crepe_fixture(args.crepe, audio, tolerance, output)
+    else:
+        layers, dense = make_layers(args.multiplier, args.seed)
+        activation = get_activation(get_frames(audio), layers, dense)
+        cents = to_viterbi_cents(activation)
+        frequency = 10 * 2 ** (cents / 1200)
+        frequency[numpy.isnan(frequency)] = 0
+        confidence = activation.max(axis=1)
+        time = numpy.arange(len(confidence)) * hop_size / sample_rate
+        reference = f"numpy crepe.core transcription (seed {args.seed}, multiplier {args.multiplier})"
+        tolerance = {"confidence": 1e-4, "cents": 1.0}
+        write_model(f"{output}/model.bin", layers, dense)
+
+    if top_margin(activation) < tolerance["confidence"]:
+        print(f"Warning: salience top-2 margin {top_margin(activation)} is within tolerance, argmax may flip", file=sys.stderr)
+
+    audio.astype("<f4").tofile(f"{output}/audio.f32")
+    with open(f"{output}/reference.json", "w") as file:
+        json.dump({"reference": reference, "sampleRate": sample_rate, "tolerance": tolerance,
+            "time": [float(v) for v in time], "frequency": [float(v) for v in frequency],
+            "confidence": [float(v) for v in confidence]}, file, indent=1)